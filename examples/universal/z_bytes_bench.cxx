@@ -0,0 +1,360 @@
+//
+// Copyright (c) 2024 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <iostream>
+#include <map>
+#include <new>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#ifdef ZENOH_CPP_EXAMPLE_WITH_PROTOBUF
+#include "bench.pb.h"
+#endif
+
+#include "../getargs.hxx"
+#include "zenoh.hxx"
+
+using namespace zenoh;
+
+// Count heap allocations performed by C++ code. Allocations made inside zenoh-c / zenoh-pico are not counted.
+static std::atomic<size_t> allocations{0};
+
+void *operator new(size_t size) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void *p = std::malloc(size > 0 ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete(void *p, size_t) noexcept { std::free(p); }
+
+struct Scalars {
+    uint64_t id;
+    int32_t x;
+    int32_t y;
+    double value;
+    bool valid;
+    ZENOH_EXT_SERIALIZE_FIELDS(id, x, y, value, valid)
+
+    bool operator==(const Scalars &other) const {
+        return id == other.id && x == other.x && y == other.y && value == other.value && valid == other.valid;
+    }
+};
+
+using Array = std::vector<float>;
+using SmallArrays = std::vector<std::vector<float>>;
+using StringMap = std::map<std::string, std::string>;
+using Nested = std::tuple<uint32_t, std::string, std::vector<std::pair<int64_t, double>>>;
+
+struct Result {
+    std::string payload;
+    std::string format;
+    size_t size;
+    double encode_ns;
+    double decode_ns;
+    double encode_allocs;
+    double decode_allocs;
+};
+
+// Run `encode` and `decode` `n` times each, and collect average time and number of allocations per message, as well
+// as size of the encoded message. `encode` returns `Bytes`, `decode` takes `const Bytes&`.
+template <class Encode, class Decode>
+Result measure(std::string payload, std::string format, size_t n, Encode &&encode, Decode &&decode) {
+    Bytes b = encode();
+    decode(b);
+    size_t sink = 0;
+
+    size_t allocs_start = allocations.load();
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < n; i++) {
+        Bytes e = encode();
+        sink += e.size();
+    }
+    auto encode_time = std::chrono::steady_clock::now() - start;
+    size_t encode_allocs = allocations.load() - allocs_start;
+
+    allocs_start = allocations.load();
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < n; i++) {
+        decode(b);
+    }
+    auto decode_time = std::chrono::steady_clock::now() - start;
+    size_t decode_allocs = allocations.load() - allocs_start;
+
+    if (sink != b.size() * n) {
+        std::cerr << "Unexpected encoded size for " << payload << "/" << format << "\n";
+    }
+    auto per_msg_ns = [n](auto d) {
+        return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(d).count()) /
+               static_cast<double>(n);
+    };
+    return Result{std::move(payload),
+                  std::move(format),
+                  b.size(),
+                  per_msg_ns(encode_time),
+                  per_msg_ns(decode_time),
+                  static_cast<double>(encode_allocs) / static_cast<double>(n),
+                  static_cast<double>(decode_allocs) / static_cast<double>(n)};
+}
+
+// Measure zenoh::ext serialization, both with a new and with a reused serializer.
+template <class T>
+void measure_ext(std::vector<Result> &results, const std::string &payload, const T &value, size_t n) {
+    T out{};
+    auto decode = [&out](const Bytes &b) { ext::deserialize_into(b, out); };
+    results.push_back(measure(payload, "ext", n, [&value]() { return ext::serialize(value); }, decode));
+    if (!(out == value)) std::cerr << "Invalid ext deserialization of " << payload << "\n";
+
+    ext::BufferedSerializer serializer;
+    results.push_back(measure(
+        payload, "ext_reused_serializer", n,
+        [&value, &serializer]() {
+            serializer.serialize(value);
+            return serializer.finish();
+        },
+        decode));
+}
+
+// Copy payload into `dst`, which must be of the payload size.
+void read_raw(const Bytes &b, uint8_t *dst) { b.reader().read(dst, b.size()); }
+
+#ifdef ZENOH_CPP_EXAMPLE_WITH_PROTOBUF
+template <class M>
+Bytes to_bytes(const M &msg) {
+    std::vector<uint8_t> wire(msg.ByteSizeLong());
+    msg.SerializeToArray(wire.data(), static_cast<int>(wire.size()));
+    return Bytes(std::move(wire));
+}
+
+// Parse message from payload, without copying it if it is contiguous.
+template <class M>
+bool from_bytes(const Bytes &b, M &msg) {
+    auto it = b.slice_iter();
+    auto slice = it.next();
+    if (slice.has_value() && slice->len == b.size()) {
+        return msg.ParseFromArray(slice->data, static_cast<int>(slice->len));
+    }
+    auto wire = b.as_vector();
+    return msg.ParseFromArray(wire.data(), static_cast<int>(wire.size()));
+}
+
+// Protobuf measurements include conversion between native types and protobuf messages, so that all formats produce
+// the same native values.
+void measure_protobuf(std::vector<Result> &results, const Scalars &scalars, const Array &array, const StringMap &map,
+                      const Nested &nested, size_t n) {
+    {
+        BenchScalars msg;
+        Scalars out{};
+        results.push_back(measure(
+            "scalars", "protobuf", n,
+            [&scalars, &msg]() {
+                msg.set_id(scalars.id);
+                msg.set_x(scalars.x);
+                msg.set_y(scalars.y);
+                msg.set_value(scalars.value);
+                msg.set_valid(scalars.valid);
+                return to_bytes(msg);
+            },
+            [&out, &msg](const Bytes &b) {
+                from_bytes(b, msg);
+                out = Scalars{msg.id(), msg.x(), msg.y(), msg.value(), msg.valid()};
+            }));
+        if (!(out == scalars)) std::cerr << "Invalid protobuf deserialization of scalars\n";
+    }
+    {
+        BenchArray msg;
+        Array out;
+        results.push_back(measure(
+            "array", "protobuf", n,
+            [&array, &msg]() {
+                msg.mutable_values()->Assign(array.begin(), array.end());
+                return to_bytes(msg);
+            },
+            [&out, &msg](const Bytes &b) {
+                from_bytes(b, msg);
+                out.assign(msg.values().begin(), msg.values().end());
+            }));
+        if (out != array) std::cerr << "Invalid protobuf deserialization of array\n";
+    }
+    {
+        BenchStringMap msg;
+        StringMap out;
+        results.push_back(measure(
+            "string_map", "protobuf", n,
+            [&map, &msg]() {
+                auto &entries = *msg.mutable_entries();
+                entries.clear();
+                for (const auto &[k, v] : map) entries[k] = v;
+                return to_bytes(msg);
+            },
+            [&out, &msg](const Bytes &b) {
+                from_bytes(b, msg);
+                out.clear();
+                for (const auto &[k, v] : msg.entries()) out.emplace(k, v);
+            }));
+        if (out != map) std::cerr << "Invalid protobuf deserialization of string map\n";
+    }
+    {
+        BenchNested msg;
+        Nested out;
+        results.push_back(measure(
+            "nested", "protobuf", n,
+            [&nested, &msg]() {
+                msg.set_id(std::get<0>(nested));
+                msg.set_name(std::get<1>(nested));
+                msg.clear_items();
+                for (const auto &[k, v] : std::get<2>(nested)) {
+                    auto *item = msg.add_items();
+                    item->set_key(k);
+                    item->set_value(v);
+                }
+                return to_bytes(msg);
+            },
+            [&out, &msg](const Bytes &b) {
+                from_bytes(b, msg);
+                std::get<0>(out) = msg.id();
+                std::get<1>(out) = msg.name();
+                auto &items = std::get<2>(out);
+                items.clear();
+                for (const auto &item : msg.items()) items.emplace_back(item.key(), item.value());
+            }));
+        if (out != nested) std::cerr << "Invalid protobuf deserialization of nested tuple\n";
+    }
+}
+#endif
+
+void print_csv(const std::vector<Result> &results) {
+    std::cout << "payload,format,size_bytes,encode_ns,decode_ns,encode_mb_s,decode_mb_s,encode_allocs,decode_allocs\n";
+    for (const auto &r : results) {
+        std::cout << r.payload << "," << r.format << "," << r.size << "," << r.encode_ns << "," << r.decode_ns << ","
+                  << static_cast<double>(r.size) * 1000.0 / r.encode_ns << ","
+                  << static_cast<double>(r.size) * 1000.0 / r.decode_ns << "," << r.encode_allocs << ","
+                  << r.decode_allocs << "\n";
+    }
+}
+
+void print_json(const std::vector<Result> &results) {
+    std::cout << "[\n";
+    for (size_t i = 0; i < results.size(); i++) {
+        const auto &r = results[i];
+        std::cout << "  {\"payload\": \"" << r.payload << "\", \"format\": \"" << r.format
+                  << "\", \"size_bytes\": " << r.size << ", \"encode_ns\": " << r.encode_ns
+                  << ", \"decode_ns\": " << r.decode_ns
+                  << ", \"encode_mb_s\": " << static_cast<double>(r.size) * 1000.0 / r.encode_ns
+                  << ", \"decode_mb_s\": " << static_cast<double>(r.size) * 1000.0 / r.decode_ns
+                  << ", \"encode_allocs\": " << r.encode_allocs << ", \"decode_allocs\": " << r.decode_allocs << "}"
+                  << (i + 1 < results.size() ? ",\n" : "\n");
+    }
+    std::cout << "]\n";
+}
+
+int _main(int argc, char **argv) {
+    auto args = CliArgParser(argc, argv)
+                    .named_value({"n", "number"}, "NUMBER", "Number of messages to encode and decode per measurement",
+                                 "100000")
+                    .named_value({"a", "array-size"}, "ARRAY_SIZE", "Number of elements of numeric array payload",
+                                 "1024")
+                    .named_value({"f", "format"}, "FORMAT", "Output format (csv | json)", "csv")
+                    .run();
+    size_t n = std::atoi(args.value("number").data());
+    size_t array_size = std::atoi(args.value("array-size").data());
+    std::string_view format = args.value("format");
+
+    Scalars scalars{123456789, -42, 42, 3.14159, true};
+    Array array(array_size);
+    for (size_t i = 0; i < array_size; i++) array[i] = static_cast<float>(i) * 0.25f;
+    StringMap map;
+    for (size_t i = 0; i < 32; i++) map.emplace("key_" + std::to_string(i), "value_" + std::to_string(i * i));
+    Nested nested{7, "nested tuple", {}};
+    for (int64_t i = 0; i < 16; i++) std::get<2>(nested).emplace_back(i * 1000, static_cast<double>(i) / 3.0);
+    // Many short numeric arrays, e.g. a batch of 3D points.
+    SmallArrays small_arrays(256, std::vector<float>{1.0f, 2.0f, 3.0f});
+
+    std::vector<Result> results;
+    measure_ext(results, "scalars", scalars, n);
+    measure_ext(results, "array", array, n);
+    measure_ext(results, "small_arrays", small_arrays, n);
+    measure_ext(results, "string_map", map, n);
+    measure_ext(results, "nested", nested, n);
+
+    // Same encoding as the array payload, but written and read with one zenoh serializer call per element, as done for
+    // containers whose elements are not contiguous in memory, instead of a single block.
+    {
+        std::deque<float> elements(array.begin(), array.end());
+        std::deque<float> out;
+        results.push_back(measure(
+            "array", "ext_element_wise", n, [&elements]() { return ext::serialize(elements); },
+            [&out](const Bytes &b) { ext::deserialize_into(b, out); }));
+        if (out != elements) std::cerr << "Invalid element-wise ext deserialization of array\n";
+    }
+
+    // Raw bytes are only applicable to trivially copyable data.
+    {
+        Scalars out{};
+        results.push_back(measure(
+            "scalars", "raw", n,
+            [&scalars]() {
+                return Bytes(std::vector<uint8_t>(reinterpret_cast<const uint8_t *>(&scalars),
+                                                  reinterpret_cast<const uint8_t *>(&scalars) + sizeof(Scalars)));
+            },
+            [&out](const Bytes &b) { read_raw(b, reinterpret_cast<uint8_t *>(&out)); }));
+        if (!(out == scalars)) std::cerr << "Invalid raw deserialization of scalars\n";
+    }
+    {
+        Array out;
+        results.push_back(measure(
+            "array", "raw", n,
+            [&array]() {
+                const uint8_t *data = reinterpret_cast<const uint8_t *>(array.data());
+                return Bytes(std::vector<uint8_t>(data, data + array.size() * sizeof(float)));
+            },
+            [&out](const Bytes &b) {
+                out.resize(b.size() / sizeof(float));
+                read_raw(b, reinterpret_cast<uint8_t *>(out.data()));
+            }));
+        if (out != array) std::cerr << "Invalid raw deserialization of array\n";
+    }
+
+#ifdef ZENOH_CPP_EXAMPLE_WITH_PROTOBUF
+    GOOGLE_PROTOBUF_VERIFY_VERSION;
+    measure_protobuf(results, scalars, array, map, nested, n);
+#endif
+
+    if (format == "json") {
+        print_json(results);
+    } else {
+        print_csv(results);
+    }
+
+#ifdef ZENOH_CPP_EXAMPLE_WITH_PROTOBUF
+    google::protobuf::ShutdownProtobufLibrary();
+#endif
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    try {
+#ifdef ZENOHCXX_ZENOHC
+        init_log_from_env_or("error");
+#endif
+        return _main(argc, argv);
+    } catch (ZException e) {
+        std::cout << "Received an error :" << e.what() << "\n";
+    }
+}
@@ -0,0 +1,99 @@
+//
+// Copyright (c) 2025 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../getargs.hxx"
+#include "zenoh.hxx"
+
+using namespace zenoh;
+
+struct Result {
+    std::string dispatch;
+    double call_ns;
+};
+
+// Invoke the callback `n` times through a C-style function pointer, as zenoh does when delivering samples,
+// and return the average time per call.
+double measure(void (*volatile f)(void *, size_t), void *context, size_t n) {
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < n; i++) f(context, i);
+    auto time = std::chrono::steady_clock::now() - start;
+    return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(time).count()) /
+           static_cast<double>(n);
+}
+
+void print_csv(const std::vector<Result> &results) {
+    std::cout << "dispatch,call_ns\n";
+    for (const auto &r : results) {
+        std::cout << r.dispatch << "," << r.call_ns << "\n";
+    }
+}
+
+void print_json(const std::vector<Result> &results) {
+    std::cout << "[\n";
+    for (size_t i = 0; i < results.size(); i++) {
+        const auto &r = results[i];
+        std::cout << "  {\"dispatch\": \"" << r.dispatch << "\", \"call_ns\": " << r.call_ns << "}"
+                  << (i + 1 < results.size() ? ",\n" : "\n");
+    }
+    std::cout << "]\n";
+}
+
+int _main(int argc, char **argv) {
+    auto args = CliArgParser(argc, argv)
+                    .named_value({"n", "number"}, "NUMBER", "Number of calls per measurement", "10000000")
+                    .named_value({"f", "format"}, "FORMAT", "Output format (csv | json)", "csv")
+                    .run();
+    size_t n = std::atoi(args.value("number").data());
+    std::string_view format = args.value("format");
+
+    size_t sum = 0;
+    auto on_call = [&sum](size_t c) { sum += c; };
+    using OnCall = decltype(on_call);
+    using ClosureType = detail::closures::Closure<OnCall, closures::None, void, size_t>;
+    void *context = ClosureType::into_context(on_call, closures::none);
+
+    std::vector<Result> results;
+    // generic trampolines call the closure through the virtual `IClosure::call`
+    results.push_back({"virtual", measure(&detail::closures::IClosure<void, size_t>::call_from_context, context, n)});
+    // trampolines bound to the closure type call the user callable directly
+    results.push_back({"static", measure(&ClosureType::call_from_context, context, n)});
+    ClosureType::delete_from_context(context);
+
+    if (sum != n * (n - 1)) {
+        std::cerr << "Unexpected number of callback invocations\n";
+    }
+
+    if (format == "json") {
+        print_json(results);
+    } else {
+        print_csv(results);
+    }
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    try {
+#ifdef ZENOHCXX_ZENOHC
+        init_log_from_env_or("error");
+#endif
+        return _main(argc, argv);
+    } catch (ZException e) {
+        std::cout << "Received an error :" << e.what() << "\n";
+    }
+}
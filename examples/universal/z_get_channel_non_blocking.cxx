@@ -50,14 +50,14 @@ int _main(int argc, char **argv) {
         options.payload = payload;
     }
     options.timeout_ms = timeout_ms;
-    auto replies = session.get(selector.key_expr, selector.parameters, channels::FifoChannel(16), std::move(options));
+    auto replies =
+        session.get(selector.key_expr, selector.parameters, channels::NotifyingFifoChannel(16), std::move(options));
 
     while (true) {
-        auto res = replies.try_recv();
+        auto res = replies.recv_for(1s);
         if (std::holds_alternative<channels::RecvError>(res)) {
             if (std::get<channels::RecvError>(res) == channels::RecvError::Z_NODATA) {
                 std::cout << ".";
-                std::this_thread::sleep_for(1s);
                 continue;
             } else {  // channel is closed - no more replies will be received
                 break;
@@ -0,0 +1,165 @@
+//
+// Copyright (c) 2025 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../getargs.hxx"
+#include "zenoh.hxx"
+
+using namespace zenoh;
+
+struct Result {
+    std::string method;
+    size_t patterns;
+    double match_ns;
+    double matches;
+};
+
+// Patterns typical of access-control filters and storages: exact keys and keys with `*`, `**` and `$*` wildcards.
+std::vector<KeyExpr> make_patterns(size_t n) {
+    std::vector<KeyExpr> patterns;
+    patterns.reserve(n);
+    for (size_t i = 0; i < n; i++) {
+        std::string robot = "robot" + std::to_string(i / 8);
+        switch (i % 8) {
+            case 0:
+                patterns.emplace_back("fleet/" + robot + "/sensor/imu");
+                break;
+            case 1:
+                patterns.emplace_back("fleet/" + robot + "/*/imu");
+                break;
+            case 2:
+                patterns.emplace_back("fleet/*/sensor/" + std::to_string(i / 8));
+                break;
+            case 3:
+                patterns.emplace_back("fleet/" + robot + "/**");
+                break;
+            case 4:
+                patterns.emplace_back("fleet/" + robot + "/sensor/gps$*");
+                break;
+            case 5:
+                patterns.emplace_back("zone" + std::to_string(i / 8) + "/**/temperature");
+                break;
+            case 6:
+                patterns.emplace_back("fleet/" + robot + "/cmd/*");
+                break;
+            default:
+                patterns.emplace_back("logs/" + robot + "/*/**");
+                break;
+        }
+    }
+    return patterns;
+}
+
+std::vector<KeyExpr> make_keys(size_t n, size_t patterns) {
+    static const char *sensors[] = {"imu", "gps1", "lidar", "7"};
+    std::vector<KeyExpr> keys;
+    keys.reserve(n);
+    size_t robots = patterns / 8 + 1;
+    for (size_t i = 0; i < n; i++) {
+        keys.emplace_back("fleet/robot" + std::to_string((i * 7919) % robots) + "/sensor/" + sensors[i % 4]);
+    }
+    return keys;
+}
+
+// Run `match` on each key, and collect average time and number of matching patterns per key.
+template <class Match>
+Result measure(std::string method, size_t patterns, const std::vector<KeyExpr> &keys, Match &&match) {
+    size_t matches = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (const auto &k : keys) {
+        matches += match(k);
+    }
+    auto time = std::chrono::steady_clock::now() - start;
+    double n = static_cast<double>(keys.size());
+    return Result{std::move(method), patterns,
+                  static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(time).count()) / n,
+                  static_cast<double>(matches) / n};
+}
+
+void print_csv(const std::vector<Result> &results) {
+    std::cout << "method,patterns,match_ns,matches_per_key\n";
+    for (const auto &r : results) {
+        std::cout << r.method << "," << r.patterns << "," << r.match_ns << "," << r.matches << "\n";
+    }
+}
+
+void print_json(const std::vector<Result> &results) {
+    std::cout << "[\n";
+    for (size_t i = 0; i < results.size(); i++) {
+        const auto &r = results[i];
+        std::cout << "  {\"method\": \"" << r.method << "\", \"patterns\": " << r.patterns
+                  << ", \"match_ns\": " << r.match_ns << ", \"matches_per_key\": " << r.matches << "}"
+                  << (i + 1 < results.size() ? ",\n" : "\n");
+    }
+    std::cout << "]\n";
+}
+
+int _main(int argc, char **argv) {
+    auto args = CliArgParser(argc, argv)
+                    .named_value({"p", "patterns"}, "PATTERNS", "Maximal number of patterns to match against", "10000")
+                    .named_value({"n", "number"}, "NUMBER", "Number of keys to match per measurement", "10000")
+                    .named_value({"f", "format"}, "FORMAT", "Output format (csv | json)", "csv")
+                    .run();
+    size_t max_patterns = std::atoi(args.value("patterns").data());
+    size_t n = std::atoi(args.value("number").data());
+    std::string_view format = args.value("format");
+
+    std::vector<Result> results;
+    for (size_t p = 10; p <= max_patterns; p *= 10) {
+        auto patterns = make_patterns(p);
+        auto keys = make_keys(n, p);
+
+        results.push_back(measure("pairwise", p, keys, [&patterns](const KeyExpr &k) {
+            size_t matches = 0;
+            for (const auto &pattern : patterns) {
+                matches += pattern.intersects(k);
+            }
+            return matches;
+        }));
+
+        KeyExprMatcher matcher;
+        for (const auto &pattern : patterns) matcher.add(pattern);
+        std::vector<size_t> out;
+        results.push_back(measure("matcher", p, keys, [&matcher, &out](const KeyExpr &k) {
+            matcher.match(k, out);
+            return out.size();
+        }));
+
+        if (results[results.size() - 1].matches != results[results.size() - 2].matches) {
+            std::cerr << "Matcher and pairwise matching results differ for " << p << " patterns\n";
+        }
+    }
+
+    if (format == "json") {
+        print_json(results);
+    } else {
+        print_csv(results);
+    }
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    try {
+#ifdef ZENOHCXX_ZENOHC
+        init_log_from_env_or("error");
+#endif
+        return _main(argc, argv);
+    } catch (ZException e) {
+        std::cout << "Received an error :" << e.what() << "\n";
+    }
+}
@@ -17,7 +17,6 @@
 #include <iostream>
 #include <mutex>
 #include <thread>
-#include <unordered_map>
 
 #include "../getargs.hxx"
 #include "zenoh.hxx"
@@ -46,7 +45,7 @@ int _main(int argc, char **argv) {
 
     std::cout << "Opening session..." << std::endl;
     auto session = Session::open(std::move(config));
-    std::unordered_map<std::string_view, Sample> storage;
+    KeyExprTree<Sample> storage;
     std::mutex storage_mutex;
 
     auto sub_handler = [&storage, &storage_mutex](Sample &sample) {
@@ -56,13 +55,10 @@ int _main(int argc, char **argv) {
 
         switch (sample.get_kind()) {
             case SampleKind::Z_SAMPLE_KIND_PUT:
-                // Note: it is safe to use string_view as a key, since it references internal sample data,
-                // so it is guaranteed to stay valid as long as corresponding map value exists.
-                storage.erase(sample.get_keyexpr().as_string_view());
-                storage.insert({sample.get_keyexpr().as_string_view(), std::move(sample)});
+                storage.insert(sample.get_keyexpr(), std::move(sample));
                 break;
             case SampleKind::Z_SAMPLE_KIND_DELETE:
-                storage.erase(sample.get_keyexpr().as_string_view());
+                storage.erase(sample.get_keyexpr());
                 break;
         }
     };
@@ -74,11 +70,10 @@ int _main(int argc, char **argv) {
         std::lock_guard<std::mutex> lock(storage_mutex);
         std::cout << ">> [Queryable ] Received Query '" << query.get_keyexpr().as_string_view() << "?"
                   << query.get_parameters() << "'\n";
-        for (const auto &[k, v] : storage) {
-            if (query.get_keyexpr().intersects(v.get_keyexpr())) {
-                query.reply(v.get_keyexpr(), v.get_payload().clone());
-            }
-        }
+        // only walks the branches of the storage matching the query key expression
+        storage.intersecting(query.get_keyexpr(), [&query](std::string_view, const Sample &v) {
+            query.reply(v.get_keyexpr(), v.get_payload().clone());
+        });
     };
 
     std::cout << "Declaring Queryable on '" << keyexpr.as_string_view() << "'..." << std::endl;
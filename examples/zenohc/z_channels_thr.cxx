@@ -0,0 +1,122 @@
+//
+// Copyright (c) 2024 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../getargs.hxx"
+#include "zenoh.hxx"
+
+using namespace zenoh;
+
+// Push `producers * number` clones of the sample through the channel callback from `producers` threads, while the
+// main thread receives them from the channel handler. Return the throughput in msg/s.
+template <class Channel>
+double measure(const Channel &channel, const Sample &sample, size_t producers, size_t number) {
+    auto [closure, handler] = channel.template into_cb_handler_pair<Sample>();
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (size_t p = 0; p < producers; p++) {
+        threads.emplace_back([&closure = closure, &sample, number]() {
+            for (size_t i = 0; i < number; i++) {
+                Sample s = sample.clone();
+                ::z_closure_sample_call(::z_loan(closure), ::z_loan_mut(*interop::as_owned_c_ptr(s)));
+            }
+        });
+    }
+    size_t received = 0;
+    std::vector<Sample> batch;
+    while (received < producers * number) {
+        batch.clear();
+        auto res = handler.recv_batch(batch, 64);
+        if (!std::holds_alternative<size_t>(res)) break;
+        received += std::get<size_t>(res);
+    }
+    auto end = std::chrono::steady_clock::now();
+    for (auto &t : threads) t.join();
+    ::z_drop(::z_move(closure));
+    auto elapsed_us = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+    return static_cast<double>(received) * 1000000.0 / static_cast<double>(elapsed_us);
+}
+
+// Throughput of sample cloning alone, which is included in all channel measurements.
+double measure_clone(const Sample &sample, size_t number) {
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < number; i++) {
+        Sample s = sample.clone();
+    }
+    auto elapsed_us =
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+    return static_cast<double>(number) * 1000000.0 / static_cast<double>(elapsed_us);
+}
+
+int _main(int argc, char **argv) {
+    auto &&[config, args] =
+        ConfigCliArgParser(argc, argv)
+            .named_value({"n", "number"}, "NUM_MESSAGES", "Number of messages sent by each producer", "1000000")
+            .named_value({"p", "producers"}, "PRODUCERS", "Number of producer threads for multi-producer channels",
+                         "4")
+            .named_value({"capacity"}, "CAPACITY", "Capacity of channel buffers", "256")
+            .named_value({"s", "size"}, "PAYLOAD_SIZE", "Size of the sample payload (number)", "8")
+            .run();
+
+    size_t number = std::atoi(args.value("number").data());
+    size_t producers = std::atoi(args.value("producers").data());
+    size_t capacity = std::atoi(args.value("capacity").data());
+    size_t size = std::atoi(args.value("size").data());
+
+    std::cout << "Opening session...\n";
+    auto session = Session::open(std::move(config));
+
+    KeyExpr keyexpr("test/channels_thr");
+    auto subscriber = session.declare_subscriber(keyexpr, channels::FifoChannel(1));
+    session.put(keyexpr, std::vector<uint8_t>(size));
+    auto res = subscriber.handler().recv();
+    if (!std::holds_alternative<Sample>(res)) {
+        std::cout << "Failed to receive a sample\n";
+        return -1;
+    }
+    const auto &sample = std::get<Sample>(res);
+
+    auto report = [](const std::string &name, double msg_s) { std::cout << name << ": " << msg_s << " msg/s\n"; };
+    report("clone only", measure_clone(sample, number));
+
+    std::cout << "1 producer:\n";
+    report("  FifoChannel", measure(channels::FifoChannel(capacity), sample, 1, number));
+    report("  SpscChannel<BlockingWait>", measure(channels::SpscChannel(capacity), sample, 1, number));
+    report("  SpscChannel<YieldWait>",
+           measure(channels::SpscChannel<channels::YieldWait>(capacity), sample, 1, number));
+    report("  SpscChannel<SpinWait>", measure(channels::SpscChannel<channels::SpinWait>(capacity), sample, 1, number));
+    report("  MpscChannel<BlockingWait>", measure(channels::MpscChannel(capacity), sample, 1, number));
+
+    std::cout << producers << " producers:\n";
+    report("  FifoChannel", measure(channels::FifoChannel(capacity), sample, producers, number));
+    report("  MpscChannel<BlockingWait>", measure(channels::MpscChannel(capacity), sample, producers, number));
+    report("  MpscChannel<YieldWait>",
+           measure(channels::MpscChannel<channels::YieldWait>(capacity), sample, producers, number));
+    report("  MpscChannel<SpinWait>",
+           measure(channels::MpscChannel<channels::SpinWait>(capacity), sample, producers, number));
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    try {
+        init_log_from_env_or("error");
+        _main(argc, argv);
+    } catch (ZException e) {
+        std::cout << "Received an error :" << e.what() << "\n";
+    }
+}
@@ -17,14 +17,21 @@
 #include "api/channels.hxx"
 #include "api/closures.hxx"
 #include "api/config.hxx"
+#include "api/conflating_channel.hxx"
+#include "api/dispatcher.hxx"
 #include "api/encoding.hxx"
+#include "api/encoding_registry.hxx"
 #include "api/enums.hxx"
 #include "api/hello.hxx"
 #include "api/id.hxx"
 #include "api/keyexpr.hxx"
+#include "api/keyexpr_cache.hxx"
+#include "api/keyexpr_format.hxx"
+#include "api/keyexpr_tree.hxx"
 #if defined(ZENOHCXX_ZENOHC) || Z_FEATURE_LIVELINESS == 1
 #include "api/liveliness.hxx"
 #endif
+#include "api/lockfree_channels.hxx"
 #include "api/logging.hxx"
 #include "api/publisher.hxx"
 #include "api/query.hxx"
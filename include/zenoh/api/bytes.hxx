@@ -39,6 +39,16 @@ inline void _zenoh_drop_with_context(void* data, void* context) {
 }
 }
 
+/// Container owned by ``Bytes``, allocated together with its drop context.
+template <class T>
+struct OwnedBuffer : public IDroppable {
+    T data;
+
+    OwnedBuffer(T&& d) : data(std::move(d)) {}
+
+    virtual void drop() override {}
+};
+
 }  // namespace detail::closures
 
 struct Slice {
@@ -63,14 +73,9 @@ class Bytes : public Owned<::z_owned_bytes_t> {
     /// @brief Construct by moving sequence of bytes.
     template <class Allocator>
     Bytes(std::vector<uint8_t, Allocator>&& v) : Bytes() {
-        std::vector<uint8_t, Allocator>* ptr = new std::vector<uint8_t, Allocator>(std::move(v));
-        auto d = [p = ptr]() mutable { delete p; };
-        using D = decltype(d);
-        using Dval = std::remove_reference_t<D>;
-        using DroppableType = typename detail::closures::Droppable<Dval>;
-        auto drop = DroppableType::into_context(std::move(d));
-        ::z_bytes_from_buf(interop::as_owned_c_ptr(*this), ptr->data(), ptr->size(),
-                           detail::closures::_zenoh_drop_with_context, drop);
+        auto ptr = new detail::closures::OwnedBuffer<std::vector<uint8_t, Allocator>>(std::move(v));
+        ::z_bytes_from_buf(interop::as_owned_c_ptr(*this), ptr->data.data(), ptr->data.size(),
+                           detail::closures::_zenoh_drop_with_context, ptr->as_context());
     }
 
     /// @brief Construct by copying sequence of charactes.
@@ -88,14 +93,9 @@ class Bytes : public Owned<::z_owned_bytes_t> {
 
     /// @brief Construct by moving a string.
     Bytes(std::string&& v) : Bytes() {
-        std::string* ptr = new std::string(std::move(v));
-        auto d = [p = ptr]() mutable { delete p; };
-        using D = decltype(d);
-        using Dval = std::remove_reference_t<D>;
-        using DroppableType = typename detail::closures::Droppable<Dval>;
-        auto drop = DroppableType::into_context(std::move(d));
-        ::z_bytes_from_buf(interop::as_owned_c_ptr(*this), reinterpret_cast<uint8_t*>(ptr->data()), ptr->size(),
-                           detail::closures::_zenoh_drop_with_context, drop);
+        auto ptr = new detail::closures::OwnedBuffer<std::string>(std::move(v));
+        ::z_bytes_from_buf(interop::as_owned_c_ptr(*this), reinterpret_cast<uint8_t*>(ptr->data.data()),
+                           ptr->data.size(), detail::closures::_zenoh_drop_with_context, ptr->as_context());
     }
 
     /// @brief Construct by taking ownership of sequence of bytes.
@@ -16,8 +16,26 @@
 //
 
 #pragma once
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <variant>
 
+#if defined(__linux__)
+#include <sys/eventfd.h>
+#include <unistd.h>
+#endif
+
+#include "../detail/closures_concrete.hxx"
+#include "../detail/ring_queues.hxx"
 #include "base.hxx"
 #include "interop.hxx"
 #include "query.hxx"
@@ -30,12 +48,290 @@ namespace zenoh::channels {
 enum class RecvError {
     /// @brief Channel is closed and will no more receive any data.
     Z_DISCONNECTED = Z_CHANNEL_DISCONNECTED,
-    /// @brief Channel is still active, but no data is currently available in its buffer,
-    /// future calls to `try_recv` might still succeed.
+    /// @brief Channel is still active, but no data is currently available in its buffer (or no data arrived before
+    /// the deadline of `recv_for` or `recv_until`), future calls to `try_recv` might still succeed.
     Z_NODATA = Z_CHANNEL_NODATA
 };
 
+/// @brief Statistics collected by a channel handler.
+///
+/// Counters are updated with relaxed atomic operations, so under concurrent access the values are approximate.
+struct ChannelStats {
+    /// @brief Number of buckets in ``queue_time_histogram``.
+    static constexpr size_t HISTOGRAM_BUCKETS = 24;
+    /// @brief Only one data entry out of ``SAMPLING_INTERVAL`` is timestamped to measure its time spent in the queue.
+    static constexpr uint64_t SAMPLING_INTERVAL = 64;
+
+    /// @brief Maximum number of entries in the channel buffer.
+    size_t capacity = 0;
+    /// @brief Number of entries currently in the channel buffer.
+    size_t depth = 0;
+    /// @brief Maximum number of entries observed in the channel buffer.
+    size_t high_water_mark = 0;
+    /// @brief Total number of entries sent to the channel.
+    uint64_t enqueued = 0;
+    /// @brief Total number of entries received from the channel handler.
+    uint64_t dequeued = 0;
+    /// @brief Total number of entries removed from a full ring buffer to make room for new ones.
+    uint64_t dropped = 0;
+    /// @brief Total number of entries sent to a full FIFO buffer, which blocked the sender until room was made.
+    uint64_t blocked = 0;
+    /// @brief Histogram of time spent in the queue by sampled entries. Bucket 0 counts entries which spent less than
+    /// 1 us in the queue, bucket ``i > 0`` counts entries which spent from 2^(i-1) us to 2^i us; the last bucket also
+    /// counts all entries which spent more time.
+    std::array<uint64_t, HISTOGRAM_BUCKETS> queue_time_histogram = {};
+};
+
 namespace detail {
+template <class T>
+struct ClosureData {};
+
+template <>
+struct ClosureData<zenoh::Sample> {
+    typedef ::z_owned_closure_sample_t closure_type;
+    typedef ::z_loaned_sample_t loaned_type;
+    static void call(const closure_type* cb, loaned_type* v) { ::z_closure_sample_call(::z_loan(*cb), v); }
+    static void create(closure_type* cb, void* context) {
+        ::z_closure(cb, zenoh::detail::closures::_zenoh_on_sample_call, zenoh::detail::closures::_zenoh_on_drop,
+                    context);
+    }
+};
+
+#if defined(ZENOHCXX_ZENOHC) || Z_FEATURE_QUERYABLE == 1
+template <>
+struct ClosureData<zenoh::Query> {
+    typedef ::z_owned_closure_query_t closure_type;
+    typedef ::z_loaned_query_t loaned_type;
+    static void call(const closure_type* cb, loaned_type* v) { ::z_closure_query_call(::z_loan(*cb), v); }
+    static void create(closure_type* cb, void* context) {
+        ::z_closure(cb, zenoh::detail::closures::_zenoh_on_query_call, zenoh::detail::closures::_zenoh_on_drop,
+                    context);
+    }
+};
+#endif
+
+#if defined(ZENOHCXX_ZENOHC) || Z_FEATURE_QUERY == 1
+template <>
+struct ClosureData<zenoh::Reply> {
+    typedef ::z_owned_closure_reply_t closure_type;
+    typedef ::z_loaned_reply_t loaned_type;
+    static void call(const closure_type* cb, loaned_type* v) { ::z_closure_reply_call(::z_loan(*cb), v); }
+    static void create(closure_type* cb, void* context) {
+        ::z_closure(cb, zenoh::detail::closures::_zenoh_on_reply_call, zenoh::detail::closures::_zenoh_on_drop,
+                    context);
+    }
+};
+#endif
+
+/// Wakes up threads waiting for data in a channel handler.
+class HandlerNotifier {
+    std::atomic<uint64_t> _events{0};
+    std::atomic<size_t> _waiters{0};
+    std::mutex _mutex;
+    std::condition_variable _cv;
+#if defined(__linux__)
+    std::atomic<int> _fd{-1};
+    std::atomic<bool> _fd_armed{false};
+#endif
+
+   public:
+    HandlerNotifier() = default;
+    HandlerNotifier(const HandlerNotifier&) = delete;
+    HandlerNotifier& operator=(const HandlerNotifier&) = delete;
+
+#if defined(__linux__)
+    ~HandlerNotifier() {
+        int fd = _fd.load();
+        if (fd != -1) ::close(fd);
+    }
+#endif
+
+    /// Signal that new data entry was pushed into the channel, or that the channel was closed.
+    void notify() {
+        _events.fetch_add(1);
+        if (_waiters.load() != 0) {
+            { std::lock_guard<std::mutex> lock(_mutex); }
+            _cv.notify_all();
+        }
+#if defined(__linux__)
+        // only the first signal after reset_fd() needs to reach the eventfd
+        if (_fd_armed.load() && _fd_armed.exchange(false)) {
+            uint64_t one = 1;
+            [[maybe_unused]] auto res = ::write(_fd.load(), &one, sizeof(one));
+        }
+#endif
+    }
+
+#if defined(__linux__)
+    /// Return eventfd readable once a signal is received after the last call to reset_fd(), creating it if necessary.
+    /// A newly created eventfd is readable right away, since data might already be buffered in the channel.
+    int get_fd() {
+        int fd = _fd.load();
+        if (fd == -1) {
+            int new_fd = ::eventfd(1, EFD_NONBLOCK | EFD_CLOEXEC);
+            if (new_fd == -1 || _fd.compare_exchange_strong(fd, new_fd)) {
+                fd = new_fd;
+            } else {
+                ::close(new_fd);
+            }
+        }
+        return fd;
+    }
+
+    /// Make eventfd non-readable until the next signal.
+    void reset_fd() {
+        int fd = _fd.load();
+        if (fd == -1) return;
+        uint64_t value;
+        [[maybe_unused]] auto res = ::read(fd, &value, sizeof(value));
+        _fd_armed.store(true);
+    }
+#endif
+
+    /// Number of signals received so far.
+    uint64_t events() const { return _events.load(); }
+
+    /// Wait until the number of signals differs from `seen`.
+    void wait(uint64_t seen) {
+        _waiters.fetch_add(1);
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _cv.wait(lock, [this, seen]() { return _events.load() != seen; });
+        }
+        _waiters.fetch_sub(1);
+    }
+
+    /// Wait until the number of signals differs from `seen`, or until deadline expires.
+    /// Return `false` on timeout.
+    template <class Clock, class Duration>
+    bool wait_until(uint64_t seen, const std::chrono::time_point<Clock, Duration>& deadline) {
+        _waiters.fetch_add(1);
+        bool res;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            res = _cv.wait_until(lock, deadline, [this, seen]() { return _events.load() != seen; });
+        }
+        _waiters.fetch_sub(1);
+        return res;
+    }
+};
+
+/// Counters of a channel handler, updated by the closure on push and by the handler on pop.
+class HandlerStats {
+    size_t _capacity;
+    bool _drop_oldest;
+    std::atomic<uint64_t> _enqueued{0};
+    std::atomic<uint64_t> _blocked{0};
+    std::atomic<size_t> _high_water_mark{0};
+    std::array<std::atomic<int64_t>, 64> _timestamps = {};
+    alignas(zenoh::detail::cache_line_size) std::atomic<uint64_t> _dequeued{0};
+    std::atomic<uint64_t> _dropped{0};
+    std::array<std::atomic<uint64_t>, ChannelStats::HISTOGRAM_BUCKETS> _histogram = {};
+
+    static int64_t now_ns() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    }
+
+    std::atomic<int64_t>& timestamp(uint64_t seq) {
+        return _timestamps[(seq / ChannelStats::SAMPLING_INTERVAL) % _timestamps.size()];
+    }
+
+    size_t depth(uint64_t enqueued, uint64_t removed) const {
+        return enqueued > removed ? static_cast<size_t>(enqueued - removed) : 0;
+    }
+
+   public:
+    HandlerStats(size_t capacity, bool drop_oldest) : _capacity(capacity), _drop_oldest(drop_oldest) {}
+
+    /// Account for an entry about to be pushed into the channel.
+    void on_push() {
+        uint64_t removed = _dequeued.load(std::memory_order_relaxed) + _dropped.load(std::memory_order_relaxed);
+        uint64_t seq = _enqueued.fetch_add(1, std::memory_order_relaxed);
+        if (depth(seq, removed) >= _capacity) {
+            (_drop_oldest ? _dropped : _blocked).fetch_add(1, std::memory_order_relaxed);
+        }
+        if (seq % ChannelStats::SAMPLING_INTERVAL == 0) {
+            timestamp(seq).store(now_ns(), std::memory_order_relaxed);
+        }
+        size_t d = std::min(depth(seq + 1, removed), _capacity);
+        size_t hwm = _high_water_mark.load(std::memory_order_relaxed);
+        while (d > hwm && !_high_water_mark.compare_exchange_weak(hwm, d, std::memory_order_relaxed)) {
+        }
+    }
+
+    /// Account for n entries fetched from the channel.
+    void on_pop(size_t n) {
+        if (n == 0) return;
+        uint64_t first = _dequeued.fetch_add(n, std::memory_order_relaxed) + _dropped.load(std::memory_order_relaxed);
+        uint64_t seq = (first + ChannelStats::SAMPLING_INTERVAL - 1) / ChannelStats::SAMPLING_INTERVAL *
+                       ChannelStats::SAMPLING_INTERVAL;
+        if (seq >= first + n) return;
+        int64_t now = now_ns();
+        for (; seq < first + n; seq += ChannelStats::SAMPLING_INTERVAL) {
+            int64_t t = timestamp(seq).exchange(0, std::memory_order_relaxed);
+            if (t == 0 || t > now) continue;
+            uint64_t us = static_cast<uint64_t>(now - t) / 1000;
+            size_t bucket = 0;
+            while (us != 0 && bucket + 1 < ChannelStats::HISTOGRAM_BUCKETS) {
+                us >>= 1;
+                bucket++;
+            }
+            _histogram[bucket].fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    ChannelStats snapshot() const {
+        ChannelStats s;
+        s.capacity = _capacity;
+        s.dequeued = _dequeued.load(std::memory_order_relaxed);
+        s.dropped = _dropped.load(std::memory_order_relaxed);
+        s.enqueued = _enqueued.load(std::memory_order_relaxed);
+        s.blocked = _blocked.load(std::memory_order_relaxed);
+        s.depth = std::min(depth(s.enqueued, s.dequeued + s.dropped), _capacity);
+        s.high_water_mark = _high_water_mark.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < ChannelStats::HISTOGRAM_BUCKETS; i++) {
+            s.queue_time_histogram[i] = _histogram[i].load(std::memory_order_relaxed);
+        }
+        return s;
+    }
+};
+
+/// Closure forwarding data entries to zenoh-c channel closure and signaling corresponding handler notifier.
+template <class T>
+class NotifyingClosure : public zenoh::detail::closures::IClosure<void, T&> {
+    using Data = ClosureData<T>;
+    typename Data::closure_type _closure;
+    std::shared_ptr<HandlerNotifier> _notifier;
+    std::shared_ptr<HandlerStats> _stats;
+
+   public:
+    NotifyingClosure(const typename Data::closure_type& closure, std::shared_ptr<HandlerNotifier> notifier,
+                     std::shared_ptr<HandlerStats> stats)
+        : _closure(closure), _notifier(std::move(notifier)), _stats(std::move(stats)) {}
+
+    virtual void call(T& v) override {
+        if (_stats != nullptr) _stats->on_push();
+        Data::call(&_closure, reinterpret_cast<typename Data::loaned_type*>(interop::as_owned_c_ptr(v)));
+        _notifier->notify();
+    }
+
+    virtual void drop() override {
+        ::z_drop(::z_move(_closure));
+        _notifier->notify();
+    }
+
+    static typename Data::closure_type wrap(const typename Data::closure_type& closure,
+                                            std::shared_ptr<HandlerNotifier> notifier,
+                                            std::shared_ptr<HandlerStats> stats) {
+        typename Data::closure_type c;
+        auto context = (new NotifyingClosure<T>(closure, std::move(notifier), std::move(stats)))->as_context();
+        Data::create(&c, context);
+        return c;
+    }
+};
+
 template <class T>
 struct FifoHandlerData {};
 
@@ -103,6 +399,47 @@ struct RingHandlerData<zenoh::Reply> {
     }
 };
 #endif
+
+template <class T, class Handler, class Container>
+std::variant<size_t, RecvError> recv_batch(const Handler& h, Container& out, size_t max_count, bool blocking) {
+    size_t n = 0;
+    z_result_t res = Z_OK;
+    while (n < max_count) {
+        T& v = out.emplace_back(interop::detail::null<T>());
+        if (blocking && n == 0) {
+            res = ::z_recv(interop::as_loaned_c_ptr(h), interop::as_owned_c_ptr(v));
+        } else {
+            res = ::z_try_recv(interop::as_loaned_c_ptr(h), interop::as_owned_c_ptr(v));
+        }
+        if (res != Z_OK) {
+            out.pop_back();
+            break;
+        }
+        n++;
+    }
+    if (n > 0 || max_count == 0) {
+        return n;
+    } else if (res == Z_CHANNEL_NODATA) {
+        return RecvError::Z_NODATA;
+    } else {
+        return RecvError::Z_DISCONNECTED;
+    }
+}
+
+template <class T, class Handler, class Clock, class Duration>
+std::variant<T, RecvError> recv_until(const Handler& h, HandlerNotifier& notifier,
+                                      const std::chrono::time_point<Clock, Duration>& deadline) {
+    while (true) {
+        uint64_t seen = notifier.events();
+        auto v = h.try_recv();
+        if (!std::holds_alternative<RecvError>(v) || std::get<RecvError>(v) != RecvError::Z_NODATA) {
+            return v;
+        }
+        if (!notifier.wait_until(seen, deadline)) {
+            return h.try_recv();
+        }
+    }
+}
 }  // namespace detail
 
 class FifoChannel;
@@ -143,6 +480,43 @@ class FifoHandler : public Owned<typename detail::FifoHandlerData<T>::handler_ty
         }
     }
 
+    /// @brief Fetch up to ``max_count`` data entries from the handler's buffer and append them to ``out``. If buffer
+    /// is empty, will block until new data entry arrives, then fetch all immediately available entries (up to
+    /// ``max_count``) without blocking.
+    /// @tparam Container sequence container of ``T`` supporting ``emplace_back``, ``back`` and ``pop_back`` (e.g.
+    /// ``std::vector<T>`` or ``std::deque<T>``). Existing content is preserved, so the same container can be cleared
+    /// and reused between calls to avoid reallocations.
+    /// @param out container to append received data entries to.
+    /// @param max_count maximum number of data entries to fetch.
+    /// @return number of received data entries, if there were any in the buffer, a receive error otherwise.
+    template <class Container>
+    std::variant<size_t, RecvError> recv_batch(Container& out, size_t max_count) const {
+        return detail::recv_batch<T>(*this, out, max_count, true);
+    }
+
+    /// @brief Fetch up to ``max_count`` data entries from the handler's buffer and append them to ``out``. If buffer
+    /// is empty, will immediately return.
+    /// @tparam Container sequence container of ``T`` supporting ``emplace_back``, ``back`` and ``pop_back`` (e.g.
+    /// ``std::vector<T>`` or ``std::deque<T>``).
+    /// @param out container to append received data entries to.
+    /// @param max_count maximum number of data entries to fetch.
+    /// @return number of received data entries, if there were any in the buffer, a receive error otherwise.
+    template <class Container>
+    std::variant<size_t, RecvError> try_recv_batch(Container& out, size_t max_count) const {
+        return detail::recv_batch<T>(*this, out, max_count, false);
+    }
+
+    /// @brief Fetch all data entries currently present in the handler's buffer and append them to ``out``. If buffer
+    /// is empty, will immediately return.
+    /// @tparam Container sequence container of ``T`` supporting ``emplace_back``, ``back`` and ``pop_back`` (e.g.
+    /// ``std::vector<T>`` or ``std::deque<T>``).
+    /// @param out container to append received data entries to.
+    /// @return number of received data entries, if there were any in the buffer, a receive error otherwise.
+    template <class Container>
+    std::variant<size_t, RecvError> try_recv_all(Container& out) const {
+        return detail::recv_batch<T>(*this, out, std::numeric_limits<size_t>::max(), false);
+    }
+
     friend class FifoChannel;
 };
 
@@ -185,6 +559,43 @@ class RingHandler : public Owned<typename detail::RingHandlerData<T>::handler_ty
         }
     }
 
+    /// @brief Fetch up to ``max_count`` data entries from the handler's buffer and append them to ``out``. If buffer
+    /// is empty, will block until new data entry arrives, then fetch all immediately available entries (up to
+    /// ``max_count``) without blocking.
+    /// @tparam Container sequence container of ``T`` supporting ``emplace_back``, ``back`` and ``pop_back`` (e.g.
+    /// ``std::vector<T>`` or ``std::deque<T>``). Existing content is preserved, so the same container can be cleared
+    /// and reused between calls to avoid reallocations.
+    /// @param out container to append received data entries to.
+    /// @param max_count maximum number of data entries to fetch.
+    /// @return number of received data entries, if there were any in the buffer, a receive error otherwise.
+    template <class Container>
+    std::variant<size_t, RecvError> recv_batch(Container& out, size_t max_count) const {
+        return detail::recv_batch<T>(*this, out, max_count, true);
+    }
+
+    /// @brief Fetch up to ``max_count`` data entries from the handler's buffer and append them to ``out``. If buffer
+    /// is empty, will immediately return.
+    /// @tparam Container sequence container of ``T`` supporting ``emplace_back``, ``back`` and ``pop_back`` (e.g.
+    /// ``std::vector<T>`` or ``std::deque<T>``).
+    /// @param out container to append received data entries to.
+    /// @param max_count maximum number of data entries to fetch.
+    /// @return number of received data entries, if there were any in the buffer, a receive error otherwise.
+    template <class Container>
+    std::variant<size_t, RecvError> try_recv_batch(Container& out, size_t max_count) const {
+        return detail::recv_batch<T>(*this, out, max_count, false);
+    }
+
+    /// @brief Fetch all data entries currently present in the handler's buffer and append them to ``out``. If buffer
+    /// is empty, will immediately return.
+    /// @tparam Container sequence container of ``T`` supporting ``emplace_back``, ``back`` and ``pop_back`` (e.g.
+    /// ``std::vector<T>`` or ``std::deque<T>``).
+    /// @param out container to append received data entries to.
+    /// @return number of received data entries, if there were any in the buffer, a receive error otherwise.
+    template <class Container>
+    std::variant<size_t, RecvError> try_recv_all(Container& out) const {
+        return detail::recv_batch<T>(*this, out, std::numeric_limits<size_t>::max(), false);
+    }
+
     friend class RingChannel;
 };
 
@@ -242,4 +653,206 @@ class RingChannel {
     }
 };
 
+class NotifyingFifoChannel;
+class NotifyingRingChannel;
+
+/// @brief A channel handler wrapping a ``FifoHandler`` or a ``RingHandler``. Constructed by ``NotifyingFifoChannel``
+/// or ``NotifyingRingChannel``.
+///
+/// In addition to the operations of the wrapped handler, it allows to wait for data with a timeout, to multiplex many
+/// handlers through file descriptors (on Linux), and optionally collects statistics.
+/// @tparam T data entry type.
+/// @tparam Handler type of the wrapped handler.
+template <class T, class Handler>
+class NotifyingHandler {
+    Handler _handler;
+    std::shared_ptr<detail::HandlerNotifier> _notifier;
+    std::shared_ptr<detail::HandlerStats> _stats;
+
+    NotifyingHandler(Handler&& handler, std::shared_ptr<detail::HandlerNotifier> notifier,
+                     std::shared_ptr<detail::HandlerStats> stats)
+        : _handler(std::move(handler)), _notifier(std::move(notifier)), _stats(std::move(stats)) {}
+
+    std::variant<T, RecvError> popped(std::variant<T, RecvError>&& v) const {
+        if (this->_stats != nullptr && std::holds_alternative<T>(v)) this->_stats->on_pop(1);
+        return std::move(v);
+    }
+
+    std::variant<size_t, RecvError> popped(std::variant<size_t, RecvError>&& n) const {
+        if (this->_stats != nullptr && std::holds_alternative<size_t>(n)) this->_stats->on_pop(std::get<size_t>(n));
+        return n;
+    }
+
+   public:
+    /// @name Methods
+
+    /// @brief Fetch a data entry from the handler's buffer. If buffer is empty, will block until new data entry
+    /// arrives.
+    /// @return received data entry, if there were any in the buffer, a receive error otherwise.
+    std::variant<T, RecvError> recv() const { return popped(this->_handler.recv()); }
+
+    /// @brief Fetch a data entry from the handler's buffer. If buffer is empty, will immediately return.
+    /// @return received data entry, if there were any in the buffer, a receive error otherwise.
+    std::variant<T, RecvError> try_recv() const { return popped(this->_handler.try_recv()); }
+
+    /// @brief Fetch a data entry from the handler's buffer. If buffer is empty, will block until new data entry
+    /// arrives or until the specified deadline is reached.
+    /// @param deadline time point after which the operation gives up waiting.
+    /// @return received data entry, if there were any in the buffer before the deadline, a receive error otherwise
+    /// (``RecvError::Z_NODATA`` if the deadline expired).
+    template <class Clock, class Duration>
+    std::variant<T, RecvError> recv_until(const std::chrono::time_point<Clock, Duration>& deadline) const {
+        if (this->_notifier == nullptr) return RecvError::Z_DISCONNECTED;
+        return detail::recv_until<T>(*this, *this->_notifier, deadline);
+    }
+
+    /// @brief Fetch a data entry from the handler's buffer. If buffer is empty, will block until new data entry
+    /// arrives or until the specified timeout elapses.
+    /// @param timeout maximum time to wait for a data entry.
+    /// @return received data entry, if there were any in the buffer before the timeout, a receive error otherwise
+    /// (``RecvError::Z_NODATA`` if the timeout elapsed).
+    template <class Rep, class Period>
+    std::variant<T, RecvError> recv_for(const std::chrono::duration<Rep, Period>& timeout) const {
+        return recv_until(std::chrono::steady_clock::now() + timeout);
+    }
+
+    /// @brief Fetch up to ``max_count`` data entries from the handler's buffer and append them to ``out``. If buffer
+    /// is empty, will block until new data entry arrives, then fetch all immediately available entries (up to
+    /// ``max_count``) without blocking.
+    /// @tparam Container sequence container of ``T`` supporting ``emplace_back``, ``back`` and ``pop_back``.
+    /// @param out container to append received data entries to.
+    /// @param max_count maximum number of data entries to fetch.
+    /// @return number of received data entries, if there were any in the buffer, a receive error otherwise.
+    template <class Container>
+    std::variant<size_t, RecvError> recv_batch(Container& out, size_t max_count) const {
+        return popped(this->_handler.recv_batch(out, max_count));
+    }
+
+    /// @brief Fetch up to ``max_count`` data entries from the handler's buffer and append them to ``out``. If buffer
+    /// is empty, will immediately return.
+    /// @tparam Container sequence container of ``T`` supporting ``emplace_back``, ``back`` and ``pop_back``.
+    /// @param out container to append received data entries to.
+    /// @param max_count maximum number of data entries to fetch.
+    /// @return number of received data entries, if there were any in the buffer, a receive error otherwise.
+    template <class Container>
+    std::variant<size_t, RecvError> try_recv_batch(Container& out, size_t max_count) const {
+        return popped(this->_handler.try_recv_batch(out, max_count));
+    }
+
+    /// @brief Fetch all data entries currently present in the handler's buffer and append them to ``out``. If buffer
+    /// is empty, will immediately return.
+    /// @tparam Container sequence container of ``T`` supporting ``emplace_back``, ``back`` and ``pop_back``.
+    /// @param out container to append received data entries to.
+    /// @return number of received data entries, if there were any in the buffer, a receive error otherwise.
+    template <class Container>
+    std::variant<size_t, RecvError> try_recv_all(Container& out) const {
+        return popped(this->_handler.try_recv_all(out));
+    }
+
+    /// @brief Get statistics of the handler's buffer.
+    /// @return statistics, if they were enabled when constructing the channel, an empty optional otherwise.
+    std::optional<ChannelStats> get_stats() const {
+        if (this->_stats == nullptr) return {};
+        return this->_stats->snapshot();
+    }
+
+#if defined(__linux__)
+    /// @brief Get a file descriptor signaling availability of data in the handler's buffer, allowing to multiplex
+    /// many handlers in a single ``poll``, ``select`` or ``epoll`` based event loop.
+    ///
+    /// The descriptor becomes readable when a new data entry arrives or when the channel is closed, and stays readable
+    /// until ``reset_fd`` is called. Once the descriptor is reported readable, call ``reset_fd`` first, then fetch
+    /// data entries with ``try_recv`` (or ``try_recv_all``) until ``RecvError::Z_NODATA`` is returned. This sequence
+    /// works both with level-triggered and edge-triggered notifications.
+    ///
+    /// The descriptor is created on the first call (and is readable right away), it is owned by the handler and must
+    /// not be closed by the user. Only available on Linux.
+    /// @return eventfd file descriptor, or -1 if it could not be created.
+    int get_fd() const { return this->_notifier != nullptr ? this->_notifier->get_fd() : -1; }
+
+    /// @brief Make the descriptor returned by ``get_fd`` non-readable until the next data entry arrives or until the
+    /// channel is closed. Only available on Linux.
+    void reset_fd() const {
+        if (this->_notifier != nullptr) this->_notifier->reset_fd();
+    }
+#endif
+
+    friend class NotifyingFifoChannel;
+    friend class NotifyingRingChannel;
+};
+
+/// @brief A FIFO channel, whose handler additionally allows to wait for data with a timeout, to multiplex many
+/// handlers through file descriptors and to collect statistics (see ``NotifyingHandler``).
+///
+/// Each data entry is forwarded to the underlying FIFO buffer through an extra closure signaling the handler, so
+/// ``FifoChannel`` should be preferred when these features are not needed.
+class NotifyingFifoChannel {
+    size_t _capacity;
+    bool _collect_stats;
+
+   public:
+    /// @brief Constructor.
+    /// @param capacity maximum number of entries in the FIFO buffer of the channel. When the buffer is full, all
+    /// new attempts to insert data will block, until an entry is fetched and the space is freed in the buffer.
+    /// @param collect_stats if ``true``, the handler will collect statistics available through
+    /// ``NotifyingHandler::get_stats``.
+    NotifyingFifoChannel(size_t capacity, bool collect_stats = false)
+        : _capacity(capacity), _collect_stats(collect_stats) {}
+
+    /// @brief Channel handler type.
+    template <class T>
+    using HandlerType = NotifyingHandler<T, FifoHandler<T>>;
+
+    /// @internal
+    /// @brief Convert channel into a pair of zenoh callback and handler for the specified type.
+    /// @tparam T entry type.
+    /// @return a callback-handler pair.
+    template <class T>
+    std::pair<typename detail::FifoHandlerData<T>::closure_type, HandlerType<T>> into_cb_handler_pair() const {
+        auto [c_closure, h] = FifoChannel(_capacity).into_cb_handler_pair<T>();
+        auto notifier = std::make_shared<detail::HandlerNotifier>();
+        std::shared_ptr<detail::HandlerStats> stats;
+        if (_collect_stats) stats = std::make_shared<detail::HandlerStats>(_capacity, false);
+        return {detail::NotifyingClosure<T>::wrap(c_closure, notifier, stats),
+                HandlerType<T>(std::move(h), std::move(notifier), std::move(stats))};
+    }
+};
+
+/// @brief A circular buffer channel, whose handler additionally allows to wait for data with a timeout, to multiplex
+/// many handlers through file descriptors and to collect statistics (see ``NotifyingHandler``).
+///
+/// Each data entry is forwarded to the underlying circular buffer through an extra closure signaling the handler, so
+/// ``RingChannel`` should be preferred when these features are not needed.
+class NotifyingRingChannel {
+    size_t _capacity;
+    bool _collect_stats;
+
+   public:
+    /// @brief Constructor.
+    /// @param capacity  maximum number of entries in circular buffer of the channel. When the buffer is full, the older
+    /// entries will be removed to provide room for the new ones.
+    /// @param collect_stats if ``true``, the handler will collect statistics available through
+    /// ``NotifyingHandler::get_stats``.
+    NotifyingRingChannel(size_t capacity, bool collect_stats = false)
+        : _capacity(capacity), _collect_stats(collect_stats) {}
+
+    /// @brief Channel handler type.
+    template <class T>
+    using HandlerType = NotifyingHandler<T, RingHandler<T>>;
+
+    /// @internal
+    /// @brief Convert channel into a pair of zenoh callback and handler for the specified type.
+    /// @tparam T entry type.
+    /// @return a callback-handler pair.
+    template <class T>
+    std::pair<typename detail::RingHandlerData<T>::closure_type, HandlerType<T>> into_cb_handler_pair() const {
+        auto [c_closure, h] = RingChannel(_capacity).into_cb_handler_pair<T>();
+        auto notifier = std::make_shared<detail::HandlerNotifier>();
+        std::shared_ptr<detail::HandlerStats> stats;
+        if (_collect_stats) stats = std::make_shared<detail::HandlerStats>(_capacity, true);
+        return {detail::NotifyingClosure<T>::wrap(c_closure, notifier, stats),
+                HandlerType<T>(std::move(h), std::move(notifier), std::move(stats))};
+    }
+};
+
 }  // namespace zenoh::channels
\ No newline at end of file
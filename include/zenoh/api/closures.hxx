@@ -12,10 +12,53 @@
 //   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
 
 #pragma once
+#include <atomic>
+#include <cstddef>
+
 namespace zenoh::closures {
 namespace detail {
 inline void none() {}
 }  // namespace detail
 static auto none = &detail::none;
 using None = decltype(none);
+
+/// @brief Interface of a memory allocator for the contexts of callbacks passed to zenoh (and of deleters of
+/// ``Bytes`` constructed from moved containers).
+///
+/// Contexts are allocated each time a callback is registered, e.g. by every ``Session::get`` call. By default they
+/// are served from an internal pool of reusable blocks, so that steady-state request paths do not reach the heap.
+/// A custom allocator can be installed with ``set_context_allocator``.
+class ContextAllocator {
+   public:
+    virtual ~ContextAllocator() = default;
+    /// @brief Allocate memory for a context.
+    /// @param size number of bytes to allocate.
+    /// @return pointer to a memory block of at least ``size`` bytes aligned to ``alignof(std::max_align_t)``, or
+    /// ``nullptr`` if the allocation failed.
+    virtual void* allocate(size_t size) = 0;
+    /// @brief Release memory previously returned by ``allocate``. Might be called from any thread.
+    /// @param ptr pointer returned by ``allocate``.
+    /// @param size the value passed to the ``allocate`` call which returned ``ptr``.
+    virtual void deallocate(void* ptr, size_t size) = 0;
+};
+
+namespace detail {
+inline std::atomic<ContextAllocator*>& context_allocator() {
+    static std::atomic<ContextAllocator*> allocator{nullptr};
+    return allocator;
+}
+}  // namespace detail
+
+/// @brief Set the allocator used for all subsequently created callback contexts.
+/// @param allocator allocator to use, or ``nullptr`` to restore the default pooled allocator. Each context is released
+/// by the allocator which created it, so the allocator must outlive all contexts it has allocated.
+inline void set_context_allocator(ContextAllocator* allocator) {
+    detail::context_allocator().store(allocator, std::memory_order_release);
+}
+
+/// @brief Get the allocator set by ``set_context_allocator``.
+/// @return the current allocator, or ``nullptr`` if the default pooled allocator is used.
+inline ContextAllocator* get_context_allocator() {
+    return detail::context_allocator().load(std::memory_order_acquire);
+}
 }  // namespace zenoh::closures
@@ -0,0 +1,258 @@
+//
+// Copyright (c) 2024 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+
+#pragma once
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+
+#include "../detail/closures_concrete.hxx"
+#include "channels.hxx"
+#include "interop.hxx"
+#include "sample.hxx"
+
+namespace zenoh::channels {
+
+namespace detail {
+/// Latest sample per key expression, in the order in which keys were first updated since they were last fetched.
+class ConflatingChannelState {
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    /// Keys reference strings stored in `_order`, which are not moved by insertions and removals at its ends.
+    std::unordered_map<std::string_view, Sample> _latest;
+    std::deque<std::string> _order;
+    size_t _overwritten = 0;
+    bool _closed = false;
+
+    std::variant<Sample, RecvError> pop(std::unique_lock<std::mutex>&) {
+        if (_order.empty()) {
+            return _closed ? RecvError::Z_DISCONNECTED : RecvError::Z_NODATA;
+        }
+        auto it = _latest.find(_order.front());
+        std::variant<Sample, RecvError> v(std::move(it->second));
+        _latest.erase(it);
+        _order.pop_front();
+        return v;
+    }
+
+   public:
+    void push(Sample& sample) {
+        std::string_view key = sample.get_keyexpr().as_string_view();
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            auto it = _latest.find(key);
+            if (it != _latest.end()) {
+                it->second = std::move(sample);
+                _overwritten++;
+                return;
+            }
+            // the key string is only copied when a new key is inserted
+            _order.emplace_back(key);
+            _latest.emplace(_order.back(), std::move(sample));
+        }
+        _cv.notify_one();
+    }
+
+    void close() {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _closed = true;
+        }
+        _cv.notify_all();
+    }
+
+    std::variant<Sample, RecvError> recv() {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _cv.wait(lock, [this]() { return !_order.empty() || _closed; });
+        return pop(lock);
+    }
+
+    std::variant<Sample, RecvError> try_recv() {
+        std::unique_lock<std::mutex> lock(_mutex);
+        return pop(lock);
+    }
+
+    template <class Clock, class Duration>
+    std::variant<Sample, RecvError> recv_until(const std::chrono::time_point<Clock, Duration>& deadline) {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _cv.wait_until(lock, deadline, [this]() { return !_order.empty() || _closed; });
+        return pop(lock);
+    }
+
+    template <class Container>
+    std::variant<size_t, RecvError> recv_batch(Container& out, size_t max_count, bool blocking) {
+        std::unique_lock<std::mutex> lock(_mutex);
+        if (blocking) {
+            _cv.wait(lock, [this]() { return !_order.empty() || _closed; });
+        }
+        if (_order.empty() && max_count > 0) {
+            return _closed ? RecvError::Z_DISCONNECTED : RecvError::Z_NODATA;
+        }
+        size_t n = 0;
+        for (; n < max_count && !_order.empty(); n++) {
+            out.emplace_back(std::move(std::get<Sample>(pop(lock))));
+        }
+        return n;
+    }
+
+    size_t size() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _order.size();
+    }
+
+    size_t overwritten() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _overwritten;
+    }
+};
+
+/// Closure storing samples into the state of a conflating channel.
+class ConflatingChannelClosure : public zenoh::detail::closures::IClosure<void, Sample&> {
+    std::shared_ptr<ConflatingChannelState> _state;
+
+   public:
+    ConflatingChannelClosure(std::shared_ptr<ConflatingChannelState> state) : _state(std::move(state)) {}
+
+    virtual void call(Sample& s) override { _state->push(s); }
+
+    virtual void drop() override { _state->close(); }
+};
+}  // namespace detail
+
+class ConflatingChannel;
+
+/// @brief A conflating channel handler, holding only the latest sample for each key expression.
+/// @tparam T data entry type, only ``Sample`` is supported.
+template <class T>
+class ConflatingHandler {
+    static_assert(std::is_same_v<T, Sample>, "ConflatingChannel only supports samples");
+    std::shared_ptr<detail::ConflatingChannelState> _state;
+
+    ConflatingHandler() : _state(std::make_shared<detail::ConflatingChannelState>()) {}
+
+   public:
+    /// @name Methods
+
+    /// @brief Fetch the sample of the key expression updated the earliest since it was last fetched. If buffer is
+    /// empty, will block until new sample arrives.
+    /// @return received sample, if there were any in the buffer, a receive error otherwise.
+    std::variant<T, RecvError> recv() const { return _state->recv(); }
+
+    /// @brief Fetch the sample of the key expression updated the earliest since it was last fetched. If buffer is
+    /// empty, will immediately return.
+    /// @return received sample, if there were any in the buffer, a receive error otherwise.
+    std::variant<T, RecvError> try_recv() const { return _state->try_recv(); }
+
+    /// @brief Fetch the sample of the key expression updated the earliest since it was last fetched. If buffer is
+    /// empty, will block until new sample arrives or until the specified deadline is reached.
+    /// @param deadline time point after which the operation gives up waiting.
+    /// @return received sample, if there were any in the buffer before the deadline, a receive error otherwise
+    /// (``RecvError::Z_NODATA`` if the deadline expired).
+    template <class Clock, class Duration>
+    std::variant<T, RecvError> recv_until(const std::chrono::time_point<Clock, Duration>& deadline) const {
+        return _state->recv_until(deadline);
+    }
+
+    /// @brief Fetch the sample of the key expression updated the earliest since it was last fetched. If buffer is
+    /// empty, will block until new sample arrives or until the specified timeout elapses.
+    /// @param timeout maximum time to wait for a sample.
+    /// @return received sample, if there were any in the buffer before the timeout, a receive error otherwise
+    /// (``RecvError::Z_NODATA`` if the timeout elapsed).
+    template <class Rep, class Period>
+    std::variant<T, RecvError> recv_for(const std::chrono::duration<Rep, Period>& timeout) const {
+        return recv_until(std::chrono::steady_clock::now() + timeout);
+    }
+
+    /// @brief Fetch up to ``max_count`` samples from the handler's buffer and append them to ``out``. If buffer is
+    /// empty, will block until new sample arrives.
+    /// @tparam Container sequence container of ``Sample`` supporting ``emplace_back`` (e.g. ``std::vector<Sample>``).
+    /// @param out container to append received samples to.
+    /// @param max_count maximum number of samples to fetch.
+    /// @return number of received samples, if there were any in the buffer, a receive error otherwise.
+    template <class Container>
+    std::variant<size_t, RecvError> recv_batch(Container& out, size_t max_count) const {
+        return _state->recv_batch(out, max_count, true);
+    }
+
+    /// @brief Fetch up to ``max_count`` samples from the handler's buffer and append them to ``out``. If buffer is
+    /// empty, will immediately return.
+    /// @tparam Container sequence container of ``Sample`` supporting ``emplace_back`` (e.g. ``std::vector<Sample>``).
+    /// @param out container to append received samples to.
+    /// @param max_count maximum number of samples to fetch.
+    /// @return number of received samples, if there were any in the buffer, a receive error otherwise.
+    template <class Container>
+    std::variant<size_t, RecvError> try_recv_batch(Container& out, size_t max_count) const {
+        return _state->recv_batch(out, max_count, false);
+    }
+
+    /// @brief Fetch the latest samples of all key expressions currently present in the handler's buffer and append
+    /// them to ``out``. If buffer is empty, will immediately return.
+    /// @tparam Container sequence container of ``Sample`` supporting ``emplace_back`` (e.g. ``std::vector<Sample>``).
+    /// @param out container to append received samples to.
+    /// @return number of received samples, if there were any in the buffer, a receive error otherwise.
+    template <class Container>
+    std::variant<size_t, RecvError> try_recv_all(Container& out) const {
+        return _state->recv_batch(out, std::numeric_limits<size_t>::max(), false);
+    }
+
+    /// @brief Get the number of key expressions with a pending sample in the handler's buffer.
+    size_t size() const { return _state->size(); }
+
+    /// @brief Get the total number of samples which were replaced by a newer sample for the same key expression
+    /// before being fetched.
+    size_t overwritten_count() const { return _state->overwritten(); }
+
+    friend class ConflatingChannel;
+};
+
+/// @brief A conflating channel, keeping only the latest sample for each key expression.
+///
+/// Each new sample replaces the pending sample with the same key expression (as returned by
+/// ``Sample::get_keyexpr``), if any, so memory usage is bounded by the number of distinct key expressions rather than
+/// by the message rate, and a slow consumer always reads the most recent state. Samples of different key expressions
+/// are fetched in the order in which their key expressions were first updated since last fetch, so a frequently
+/// updated key expression can not starve the others.
+class ConflatingChannel {
+   public:
+    /// @brief Constructor.
+    ConflatingChannel() = default;
+
+    /// @brief Channel handler type.
+    template <class T>
+    using HandlerType = ConflatingHandler<T>;
+
+    /// @internal
+    /// @brief Convert channel into a pair of zenoh callback and handler for the specified type.
+    /// @tparam T entry type, only ``Sample`` is supported.
+    /// @return a callback-handler pair.
+    template <class T>
+    std::pair<typename detail::ClosureData<T>::closure_type, HandlerType<T>> into_cb_handler_pair() const {
+        HandlerType<T> h;
+        typename detail::ClosureData<T>::closure_type c_closure;
+        auto context = (new detail::ConflatingChannelClosure(h._state))->as_context();
+        detail::ClosureData<T>::create(&c_closure, context);
+        return {c_closure, std::move(h)};
+    }
+};
+
+}  // namespace zenoh::channels
@@ -0,0 +1,284 @@
+//
+// Copyright (c) 2024 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../detail/closures.hxx"
+#include "sample.hxx"
+
+namespace zenoh {
+
+/// @brief Policy applied by ``Dispatcher`` when the queue of the selected worker is full.
+enum class DispatchOverflow {
+    /// @brief Block the calling zenoh thread until there is room in the queue.
+    BLOCK,
+    /// @brief Discard the incoming sample.
+    DROP_NEWEST,
+    /// @brief Discard the oldest sample in the queue to make room for the incoming one.
+    DROP_OLDEST
+};
+
+/// @brief Criteria used by ``Dispatcher`` to select the worker processing a sample. Samples mapped to the same worker
+/// are processed sequentially in their arrival order.
+enum class DispatchAffinity {
+    /// @brief Samples with the same key expression are processed by the same worker.
+    KEY_EXPR,
+#if defined(Z_FEATURE_UNSTABLE_API)
+    /// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future
+    /// release.
+    /// @brief Samples published by the same source entity are processed by the same worker. Samples without source
+    /// info fall back to ``KEY_EXPR`` affinity.
+    SOURCE,
+#endif
+};
+
+namespace detail {
+/// User callbacks of a subscriber served by a dispatcher. `on_drop` is called once the subscriber is dropped and
+/// all its samples have been processed.
+class DispatchTarget {
+    std::unique_ptr<closures::IClosure<void, Sample&>> _closure;
+
+   public:
+    DispatchTarget(std::unique_ptr<closures::IClosure<void, Sample&>> closure) : _closure(std::move(closure)) {}
+    void call(Sample& s) { _closure->call(s); }
+    ~DispatchTarget() { _closure->drop(); }
+};
+
+struct DispatchTask {
+    std::shared_ptr<DispatchTarget> target;
+    Sample sample;
+};
+
+/// Bounded queue of a single dispatcher worker.
+class DispatchQueue {
+    std::mutex _mutex;
+    std::condition_variable _not_empty;
+    std::condition_variable _not_full;
+    std::deque<DispatchTask> _tasks;
+    size_t _capacity;
+    bool _stopped = false;
+
+   public:
+    DispatchQueue(size_t capacity) : _capacity(std::max<size_t>(capacity, 1)) {}
+
+    /// Push task into the queue according to overflow policy. Return false if the task (or another one) was dropped
+    /// to respect the capacity, true otherwise. Tasks pushed after stop are executed in place.
+    bool push(DispatchTask&& task, DispatchOverflow overflow) {
+        bool accepted = true;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            if (_tasks.size() >= _capacity && !_stopped) {
+                switch (overflow) {
+                    case DispatchOverflow::BLOCK:
+                        _not_full.wait(lock, [this]() { return _tasks.size() < _capacity || _stopped; });
+                        break;
+                    case DispatchOverflow::DROP_NEWEST:
+                        return false;
+                    case DispatchOverflow::DROP_OLDEST:
+                        _tasks.pop_front();
+                        accepted = false;
+                        break;
+                }
+            }
+            if (!_stopped) {
+                _tasks.push_back(std::move(task));
+                lock.unlock();
+                _not_empty.notify_one();
+                return accepted;
+            }
+        }
+        task.target->call(task.sample);
+        return accepted;
+    }
+
+    /// Process tasks until the queue is stopped and empty.
+    void run() {
+        std::unique_lock<std::mutex> lock(_mutex);
+        while (true) {
+            _not_empty.wait(lock, [this]() { return !_tasks.empty() || _stopped; });
+            if (_tasks.empty()) return;
+            DispatchTask task = std::move(_tasks.front());
+            _tasks.pop_front();
+            lock.unlock();
+            _not_full.notify_one();
+            task.target->call(task.sample);
+            task.target.reset();
+            lock.lock();
+        }
+    }
+
+    void stop() {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stopped = true;
+        }
+        _not_empty.notify_all();
+        _not_full.notify_all();
+    }
+};
+
+struct DispatcherState {
+    std::vector<std::unique_ptr<DispatchQueue>> queues;
+    DispatchOverflow overflow;
+    DispatchAffinity affinity;
+    std::atomic<uint64_t> dropped{0};
+
+    size_t select_queue(const Sample& s) const {
+        size_t h;
+#if defined(Z_FEATURE_UNSTABLE_API)
+        auto si = s.get_source_info();
+        if (affinity == DispatchAffinity::SOURCE && si.has_value()) {
+            auto id = si->get().id();
+            h = std::hash<Id>()(id.id());
+            h ^= std::hash<uint32_t>()(id.eid()) + 0x9e3779b9 + (h << 6) + (h >> 2);
+        } else
+#endif
+        {
+            h = std::hash<std::string_view>()(s.get_keyexpr().as_string_view());
+        }
+        return h % queues.size();
+    }
+
+    void dispatch(const std::shared_ptr<DispatchTarget>& target, Sample& s) {
+        auto& q = *queues[select_queue(s)];
+        if (!q.push(DispatchTask{target, std::move(s)}, overflow)) {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+};
+
+/// Sample callback moving samples to the dispatcher workers.
+class DispatchingCallback {
+    std::shared_ptr<DispatcherState> _state;
+    std::shared_ptr<DispatchTarget> _target;
+
+   public:
+    DispatchingCallback(std::shared_ptr<DispatcherState> state, std::shared_ptr<DispatchTarget> target)
+        : _state(std::move(state)), _target(std::move(target)) {}
+
+    void operator()(Sample& s) const { _state->dispatch(_target, s); }
+};
+}  // namespace detail
+
+/// @brief A pool of worker threads processing samples received by subscriber callbacks, so that slow callbacks do
+/// not stall zenoh network threads.
+///
+/// Samples are distributed among workers according to ``DispatchAffinity``: samples mapped to the same worker are
+/// processed sequentially in arrival order, while samples mapped to different workers are processed in parallel.
+/// Each worker has a bounded queue; ``DispatchOverflow`` defines the behavior when it is full.
+///
+/// Usage:
+/// @code{.cpp}
+/// Dispatcher dispatcher;
+/// session.declare_background_subscriber(key_expr, dispatcher.wrap(on_sample, on_drop), closures::none);
+/// @endcode
+class Dispatcher {
+    std::shared_ptr<detail::DispatcherState> _state;
+    std::vector<std::thread> _workers;
+
+   public:
+    /// @brief Options to be passed when constructing a ``Dispatcher``.
+    struct DispatcherOptions {
+        /// @name Fields
+
+        /// @brief Number of worker threads, if 0 the number of hardware threads is used.
+        size_t num_workers = 0;
+        /// @brief Maximum number of pending samples in the queue of each worker.
+        size_t queue_capacity = 1024;
+        /// @brief Policy applied when the queue of a worker is full.
+        DispatchOverflow overflow = DispatchOverflow::BLOCK;
+        /// @brief Criteria used to select the worker processing a sample.
+        DispatchAffinity affinity = DispatchAffinity::KEY_EXPR;
+
+        /// @name Methods
+
+        /// @brief Create default option settings.
+        static DispatcherOptions create_default() { return {}; }
+    };
+
+    /// @name Constructors
+
+    /// @brief Create a dispatcher and start its worker threads.
+    /// @param options options to pass to dispatcher creation.
+    Dispatcher(DispatcherOptions&& options = DispatcherOptions::create_default())
+        : _state(std::make_shared<detail::DispatcherState>()) {
+        size_t num_workers = options.num_workers;
+        if (num_workers == 0) {
+            num_workers = std::max<unsigned>(std::thread::hardware_concurrency(), 1);
+        }
+        _state->overflow = options.overflow;
+        _state->affinity = options.affinity;
+        for (size_t i = 0; i < num_workers; i++) {
+            _state->queues.emplace_back(std::make_unique<detail::DispatchQueue>(options.queue_capacity));
+        }
+        for (size_t i = 0; i < num_workers; i++) {
+            _workers.emplace_back([q = _state->queues[i].get()]() { q->run(); });
+        }
+    }
+
+    Dispatcher(const Dispatcher&) = delete;
+    Dispatcher& operator=(const Dispatcher&) = delete;
+
+    /// @brief Destructor. Processes all pending samples and stops worker threads. Samples arriving to callbacks of
+    /// this dispatcher afterwards are processed on the calling zenoh thread.
+    ~Dispatcher() {
+        for (auto& q : _state->queues) q->stop();
+        for (auto& w : _workers) w.join();
+    }
+
+    /// @name Methods
+
+    /// @brief Wrap sample callback, so that it is executed by the dispatcher workers.
+    /// @param on_sample the callable that will be called on a worker thread each time a sample is received by the
+    /// subscriber.
+    /// @param on_drop the callable that will be called once the subscriber is undeclared or dropped and all its
+    /// samples have been processed.
+    /// @return callable to pass as ``on_sample`` argument to ``Session::declare_subscriber`` (or
+    /// ``Session::declare_background_subscriber``), together with ``closures::none`` as ``on_drop``.
+    template <class C, class D>
+    detail::DispatchingCallback wrap(C&& on_sample, D&& on_drop) const {
+        static_assert(
+            std::is_invocable_r<void, C, Sample&>::value,
+            "on_sample should be callable with the following signature: void on_sample(zenoh::Sample& sample)");
+        static_assert(std::is_invocable_r<void, D>::value,
+                      "on_drop should be callable with the following signature: void on_drop()");
+        using Cval = std::remove_reference_t<C>;
+        using Dval = std::remove_reference_t<D>;
+        using ClosureType = typename detail::closures::Closure<Cval, Dval, void, Sample&>;
+        auto target = std::make_shared<detail::DispatchTarget>(
+            std::make_unique<ClosureType>(std::forward<C>(on_sample), std::forward<D>(on_drop)));
+        return detail::DispatchingCallback(_state, std::move(target));
+    }
+
+    /// @brief Get the number of worker threads.
+    size_t get_num_workers() const { return _workers.size(); }
+
+    /// @brief Get the total number of samples discarded due to queue overflow.
+    uint64_t get_dropped_count() const { return _state->dropped.load(std::memory_order_relaxed); }
+};
+
+}  // namespace zenoh
@@ -21,6 +21,9 @@
 namespace zenoh {
 
 /// @brief The <a href="https://zenoh.io/docs/manual/abstractions/#encoding"> encoding </a> of Zenoh data.
+///
+/// ``std::hash`` is not specialized for encodings, since hashing them would require formatting them into strings. To
+/// use encodings as keys of hash maps, map them to small integer ids with an ``EncodingRegistry``.
 class Encoding : public Owned<::z_owned_encoding_t> {
    public:
     /// @name Constructors
@@ -0,0 +1,229 @@
+//
+// Copyright (c) 2024 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "base.hxx"
+#include "encoding.hxx"
+#include "interop.hxx"
+
+namespace zenoh {
+
+/// @brief Small integer identifying an encoding interned in an ``EncodingRegistry``.
+using EncodingId = uint16_t;
+
+/// @brief A registry interning encodings (including their schema), and mapping them to stable small integers.
+///
+/// Predefined encodings (i.e. the ones of ``Encoding::Predefined``, without schema) are registered at construction,
+/// with ids equal to their index in ``EncodingRegistry::PREDEFINED``, so that they can be used as ``case`` labels:
+///
+/// @code{.cpp}
+/// switch (registry.find(sample.get_encoding()).value_or(EncodingRegistry::UNKNOWN)) {
+///     case EncodingRegistry::predefined_id("application/json"): ...
+///     case EncodingRegistry::predefined_id("application/protobuf"): ...
+///     default: ...
+/// }
+/// @endcode
+///
+/// Other encodings receive consecutive ids in order of registration, so they are stable across processes as long as
+/// they are registered in the same order. Once an encoding has been mapped to its id with ``EncodingRegistry::find``
+/// (whose cost is described there), comparing and dispatching on the id is free, and the interned ``Encoding`` objects
+/// can be passed by reference (e.g. to ``Session::PublisherOptions``) without being re-created from strings.
+///
+/// Registering encodings is not thread-safe, while lookups can be performed concurrently from several threads as
+/// long as no encoding is registered at the same time. A typical use is to register all encodings at startup.
+class EncodingRegistry {
+    struct Entry {
+        Encoding encoding;
+        std::string name;
+    };
+
+    /// Entries are never moved once added, so that references to them remain valid.
+    std::deque<Entry> _entries;
+    /// Keys reference `Entry::name`.
+    std::unordered_map<std::string_view, EncodingId> _ids;
+
+   public:
+    /// @brief Names of predefined encodings, in order of their ids.
+    static constexpr std::string_view PREDEFINED[] = {"zenoh/bytes",
+                                                      "zenoh/string",
+                                                      "zenoh/serialized",
+                                                      "application/octet-stream",
+                                                      "text/plain",
+                                                      "application/json",
+                                                      "text/json",
+                                                      "application/cdr",
+                                                      "application/cbor",
+                                                      "application/yaml",
+                                                      "text/yaml",
+                                                      "text/json5",
+                                                      "application/python-serialized-object",
+                                                      "application/protobuf",
+                                                      "application/java-serialized-object",
+                                                      "application/openmetrics-text",
+                                                      "image/png",
+                                                      "image/jpeg",
+                                                      "image/gif",
+                                                      "image/bmp",
+                                                      "image/webp",
+                                                      "application/xml",
+                                                      "application/x-www-form-urlencoded",
+                                                      "text/html",
+                                                      "text/xml",
+                                                      "text/css",
+                                                      "text/javascript",
+                                                      "text/markdown",
+                                                      "text/csv",
+                                                      "application/sql",
+                                                      "application/coap-payload",
+                                                      "application/json-patch+json",
+                                                      "application/json-seq",
+                                                      "application/jsonpath",
+                                                      "application/jwt",
+                                                      "application/mp4",
+                                                      "application/soap+xml",
+                                                      "application/yang",
+                                                      "audio/aac",
+                                                      "audio/flac",
+                                                      "audio/mp4",
+                                                      "audio/ogg",
+                                                      "audio/vorbis",
+                                                      "video/h261",
+                                                      "video/h263",
+                                                      "video/h264",
+                                                      "video/h265",
+                                                      "video/h266",
+                                                      "video/mp4",
+                                                      "video/ogg",
+                                                      "video/raw",
+                                                      "video/vp8",
+                                                      "video/vp9"};
+
+    /// @brief Number of predefined encodings, ids of other encodings start from this value.
+    static constexpr EncodingId PREDEFINED_COUNT = static_cast<EncodingId>(std::size(PREDEFINED));
+
+    /// @brief Id which is never assigned to an encoding, it can be used to represent unknown encodings.
+    static constexpr EncodingId UNKNOWN = std::numeric_limits<EncodingId>::max();
+
+    /// @brief Get the id of a predefined encoding at compile time.
+    /// @param name name of the predefined encoding, without schema.
+    /// @return id of the encoding, or ``UNKNOWN`` if ``name`` is not the name of a predefined encoding.
+    static constexpr EncodingId predefined_id(std::string_view name) {
+        for (EncodingId i = 0; i < PREDEFINED_COUNT; i++) {
+            if (PREDEFINED[i] == name) return i;
+        }
+        return UNKNOWN;
+    }
+
+    /// @name Constructors
+
+    /// @brief Create a registry containing only the predefined encodings.
+    EncodingRegistry() {
+        for (std::string_view name : PREDEFINED) this->intern(name);
+    }
+
+    EncodingRegistry(const EncodingRegistry&) = delete;
+    EncodingRegistry& operator=(const EncodingRegistry&) = delete;
+
+    /// @name Methods
+
+    /// @brief Register an encoding if it is not registered yet.
+    /// @param encoding encoding to register.
+    /// @param err if not null, the result code will be written to this location, otherwise ZException exception will be
+    /// thrown in case of error (i.e. if the registry is full).
+    /// @return id of the encoding, or ``UNKNOWN`` in case of error.
+    EncodingId intern(const Encoding& encoding, ZResult* err = nullptr) {
+        std::string name = encoding.as_string();
+        auto it = this->_ids.find(name);
+        if (it != this->_ids.end()) {
+            __ZENOH_RESULT_CHECK(Z_OK, err, "");
+            return it->second;
+        }
+        if (this->_entries.size() >= UNKNOWN) {
+            __ZENOH_RESULT_CHECK(-1, err, std::string("Encoding registry is full, failed to register ").append(name));
+            return UNKNOWN;
+        }
+        EncodingId id = static_cast<EncodingId>(this->_entries.size());
+        this->_entries.push_back(Entry{Encoding(encoding), std::move(name)});
+        this->_ids.emplace(this->_entries.back().name, id);
+        __ZENOH_RESULT_CHECK(Z_OK, err, "");
+        return id;
+    }
+
+    /// @brief Register an encoding if it is not registered yet.
+    /// @param encoding string representation of the encoding to register, e.g. ``text/plain;utf-8``.
+    /// @param err if not null, the result code will be written to this location, otherwise ZException exception will be
+    /// thrown in case of error.
+    /// @return id of the encoding, or ``UNKNOWN`` in case of error.
+    EncodingId intern(std::string_view encoding, ZResult* err = nullptr) {
+        auto it = this->_ids.find(encoding);
+        if (it != this->_ids.end()) {
+            __ZENOH_RESULT_CHECK(Z_OK, err, "");
+            return it->second;
+        }
+        Encoding e(encoding, err);
+        if (err != nullptr && *err != Z_OK) return UNKNOWN;
+        return this->intern(e, err);
+    }
+
+    /// @brief Find the id of a registered encoding, e.g. the one returned by ``Sample::get_encoding``.
+    ///
+    /// The encoding is first compared with the predefined encodings using ``z_encoding_equals``, which does not
+    /// allocate. Only if it is not one of them (e.g. if it has a schema), it is formatted by zenoh into a temporary
+    /// string which is then looked up, so such lookups allocate.
+    /// @param encoding encoding to look up.
+    /// @return id of the encoding, or an empty optional if it is not registered.
+    std::optional<EncodingId> find(const Encoding& encoding) const {
+        for (EncodingId i = 0; i < PREDEFINED_COUNT; i++) {
+            if (this->_entries[i].encoding == encoding) return i;
+        }
+        ::z_owned_string_t s;
+        ::z_encoding_to_string(interop::as_loaned_c_ptr(encoding), &s);
+        auto out = this->find(std::string_view(::z_string_data(::z_loan(s)), ::z_string_len(::z_loan(s))));
+        ::z_drop(::z_move(s));
+        return out;
+    }
+
+    /// @brief Find the id of a registered encoding.
+    /// @param encoding string representation of the encoding to look up, as returned by ``Encoding::as_string``.
+    /// @return id of the encoding, or an empty optional if it is not registered.
+    std::optional<EncodingId> find(std::string_view encoding) const {
+        auto it = this->_ids.find(encoding);
+        if (it == this->_ids.end()) return {};
+        return it->second;
+    }
+
+    /// @brief Get a registered encoding.
+    /// @param id id of the encoding, it must have been returned by this registry.
+    /// @return reference to the encoding, valid for the lifetime of the registry.
+    const Encoding& get(EncodingId id) const { return this->_entries[id].encoding; }
+
+    /// @brief Get the string representation of a registered encoding.
+    /// @param id id of the encoding, it must have been returned by this registry.
+    /// @return string representation of the encoding, valid for the lifetime of the registry.
+    std::string_view name(EncodingId id) const { return this->_entries[id].name; }
+
+    /// @brief Get the number of registered encodings (including predefined ones).
+    size_t size() const { return this->_entries.size(); }
+};
+
+}  // namespace zenoh
@@ -188,7 +188,7 @@ class AdvancedPublisher : public Owned<::ze_owned_advanced_publisher_t> {
         zenoh::ZResult res = ::z_publisher_declare_matching_listener(
             interop::as_loaned_c_ptr(*this), interop::as_owned_c_ptr(m), ::z_move(cb_handler_pair.first));
         if (res != Z_OK && err == nullptr) {
-            ::z_drop(interop::as_moved_c_ptr(cb_handler_pair.second));
+            interop::detail::drop_handler(cb_handler_pair.second);
         }
         __ZENOH_RESULT_CHECK(res, err, "Failed to declare Matching Listener");
         return MatchingListener<typename Channel::template HandlerType<MatchingStatus>>(
@@ -116,8 +116,8 @@ class AdvancedSubscriberBase : public Owned<::ze_owned_advanced_subscriber_t> {
         using Dval = std::remove_reference_t<D>;
         using ClosureType = typename zenoh::detail::closures::Closure<Cval, Dval, void, zenoh::Sample&>;
         auto closure = ClosureType::into_context(std::forward<C>(on_sample), std::forward<D>(on_drop));
-        ::z_closure(&c_closure, zenoh::detail::closures::_zenoh_on_sample_call, zenoh::detail::closures::_zenoh_on_drop,
-                    closure);
+        ::z_closure(&c_closure, zenoh::detail::closures::_zenoh_on_sample_call_static<ClosureType>,
+                    zenoh::detail::closures::_zenoh_on_drop_static<ClosureType>, closure);
         ::z_liveliness_subscriber_options_t opts = zenoh::interop::detail::Converter::to_c_opts(options);
         zenoh::Subscriber<void> s = zenoh::interop::detail::null<zenoh::Subscriber<void>>();
         zenoh::ZResult res = ::ze_advanced_subscriber_detect_publishers(
@@ -149,8 +149,8 @@ class AdvancedSubscriberBase : public Owned<::ze_owned_advanced_subscriber_t> {
         using Dval = std::remove_reference_t<D>;
         using ClosureType = typename zenoh::detail::closures::Closure<Cval, Dval, void, zenoh::Sample&>;
         auto closure = ClosureType::into_context(std::forward<C>(on_sample), std::forward<D>(on_drop));
-        ::z_closure(&c_closure, zenoh::detail::closures::_zenoh_on_sample_call, zenoh::detail::closures::_zenoh_on_drop,
-                    closure);
+        ::z_closure(&c_closure, zenoh::detail::closures::_zenoh_on_sample_call_static<ClosureType>,
+                    zenoh::detail::closures::_zenoh_on_drop_static<ClosureType>, closure);
         ::z_liveliness_subscriber_options_t opts = zenoh::interop::detail::Converter::to_c_opts(options);
         zenoh::ZResult res = ::ze_advanced_subscriber_detect_publishers_background(
             zenoh::interop::as_loaned_c_ptr(*this), ::z_move(c_closure), &opts);
@@ -179,7 +179,7 @@ class AdvancedSubscriberBase : public Owned<::ze_owned_advanced_subscriber_t> {
             ::z_liveliness_declare_subscriber(zenoh::interop::as_loaned_c_ptr(*this), zenoh::interop::as_owned_c_ptr(s),
                                               ::z_move(cb_handler_pair.first), &opts);
         if (res != Z_OK && err == nullptr) {
-            ::z_drop(interop::as_moved_c_ptr(cb_handler_pair.second));
+            interop::detail::drop_handler(cb_handler_pair.second);
         }
         __ZENOH_RESULT_CHECK(res, err, "Failed to declare Liveliness Token Subscriber");
         return zenoh::Subscriber<typename Channel::template HandlerType<zenoh::Sample>>(
@@ -37,7 +37,7 @@ class QueryingSubscriberBase : public Owned<::ze_owned_querying_subscriber_t> {
     /// @param options query options.
     /// @param err if not null, the result code will be written to this location, otherwise ZException exception will be
     /// thrown in case of error.
-    void get(const KeyExpr& key_expr,
+    void get(const KeyExprView& key_expr,
              zenoh::Session::GetOptions&& options = zenoh::Session::GetOptions::create_default(),
              ZResult* err = nullptr) const {
         ::z_get_options_t opts;
@@ -16,15 +16,21 @@
 #if __cplusplus >= 202002L
 #include <span>
 #endif
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <deque>
+#include <iterator>
 #include <map>
+#include <memory>
+#include <optional>
 #include <set>
 #include <string>
 #include <string_view>
 #include <tuple>
+#include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -34,13 +40,80 @@
 #include "../bytes.hxx"
 #include "../interop.hxx"
 
+/// @brief Make a struct serializable by listing its fields, which are serialized in the specified order as a tuple.
+/// Should be placed inside the struct definition, e.g.:
+/// @code{.cpp}
+/// struct Point {
+///     int32_t x;
+///     int32_t y;
+///     ZENOH_EXT_SERIALIZE_FIELDS(x, y)
+/// };
+/// @endcode
+/// If all fields have fixed serialized size (arithmetic types, ``std::array``, ``std::tuple``, ``std::pair`` and
+/// other such structs), the size is computed at compile time and the value is serialized into a single preallocated
+/// buffer.
+#define ZENOH_EXT_SERIALIZE_FIELDS(...)                           \
+    auto __zenoh_fields() { return std::tie(__VA_ARGS__); }       \
+    auto __zenoh_fields() const { return std::tie(__VA_ARGS__); }
+
 namespace zenoh {
 namespace ext {
 
+class Serializer;
+class BufferedSerializer;
+class Deserializer;
+template <class T>
+class SequenceRange;
+
+namespace detail {
+/// Arithmetic types whose sequences are serialized as a single block of little-endian values.
+template <class T>
+inline constexpr bool is_bulk_serializable_v =
+    std::is_same_v<T, uint8_t> || std::is_same_v<T, uint16_t> || std::is_same_v<T, uint32_t> ||
+    std::is_same_v<T, uint64_t> || std::is_same_v<T, int8_t> || std::is_same_v<T, int16_t> ||
+    std::is_same_v<T, int32_t> || std::is_same_v<T, int64_t> || std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+template <class T>
+struct bulk_sequence : std::false_type {
+    static constexpr bool fixed_size = false;
+};
+
+template <class T, class Allocator>
+struct bulk_sequence<std::vector<T, Allocator>> : std::bool_constant<is_bulk_serializable_v<T>> {
+    static constexpr bool fixed_size = false;
+};
+
+template <class T, size_t N>
+struct bulk_sequence<std::array<T, N>> : std::bool_constant<is_bulk_serializable_v<T>> {
+    static constexpr bool fixed_size = true;
+};
+
+template <class T>
+bool deserialize_bulk_sequence(const Bytes& bytes, T& value, ZResult* err);
+
+template <class T, class = void>
+struct fixed_size;
+
+template <class T>
+zenoh::Bytes serialize_fixed(const T& value, ZResult* err);
+
+template <class T>
+zenoh::Bytes serialize_bulk_sequence(const T& value, ZResult* err);
+
+template <class T>
+bool deserialize_fixed(const Bytes& bytes, T& value, ZResult* err);
+
+struct SerializerAccess;
+}  // namespace detail
+
 /// @brief A Zenoh data serializer used for incremental serialization of several values.
 /// I.e. data produced by subsequent calls to `Serializer::serialize` can be read by corresponding calls to
 /// `Deserializer::deserialize` in the same order (or alternatively by a single call to `deserialize`
 /// into tuple of serialized types).
+///
+/// Each value is written with zenoh serializer calls, e.g. a ``std::vector<float>`` is serialized element by element.
+/// ``BufferedSerializer`` produces the same data, but writes long sequences of arithmetic and fixed size values as
+/// contiguous blocks.
 class Serializer : public Owned<::ze_owned_serializer_t> {
    public:
     /// @name Constructors
@@ -66,6 +139,95 @@ class Serializer : public Owned<::ze_owned_serializer_t> {
     }
 };
 
+/// @brief A serializer writing sequences of arithmetic values (e.g. ``std::vector<float>``) and of fixed size values
+/// (e.g. vectors of structs serialized with ``ZENOH_EXT_SERIALIZE_FIELDS``) as contiguous blocks, instead of value by
+/// value. It is used by ``zenoh::ext::serialize``, and produces the same data as ``Serializer``.
+///
+/// Fixed size values are encoded in a scratch buffer, which is kept when the serializer is reused for the next
+/// message with ``BufferedSerializer::finish() &`` or ``BufferedSerializer::reset``. The memory holding serialized
+/// data is allocated by zenoh for each message, since it is owned by the returned ``Bytes``.
+///
+/// Custom serialization functions taking a ``Serializer`` reference can be passed a ``BufferedSerializer``, in which
+/// case the values they serialize are written value by value.
+class BufferedSerializer {
+    Serializer _serializer;
+    /// Data serialized before the last raw block write, if any.
+    std::optional<Bytes::Writer> _head;
+    /// Memory for encoding sequences of fixed size values, kept across messages.
+    std::vector<uint8_t> _scratch;
+
+    /// Move data serialized so far into `_head`.
+    bool flush(ZResult* err) {
+        Bytes b = std::move(_serializer).finish();
+        _serializer = Serializer();
+        if (!_head.has_value()) _head.emplace();
+        _head->append(std::move(b), err);
+        return err == nullptr || *err == Z_OK;
+    }
+
+    /// Append raw data after the data serialized so far.
+    void write_raw(const uint8_t* data, size_t len, ZResult* err) {
+        if (flush(err)) _head->write_all(data, len, err);
+    }
+
+    /// Get a buffer of at least `len` bytes for encoding raw blocks, it is reused across serializations.
+    uint8_t* scratch(size_t len) {
+        if (_scratch.size() < len) _scratch.resize(len);
+        return _scratch.data();
+    }
+
+    friend struct detail::SerializerAccess;
+
+   public:
+    /// @name Constructors
+
+    /// @brief Constructs an empty serializer.
+    BufferedSerializer() = default;
+
+    /// @name Methods
+
+    /// @brief Serialize specified value and append it to the underlying `Bytes`.
+    /// @param value value to serialize.
+    /// @param err if not null, the result code will be written to this location, otherwise ZException exception
+    /// will be thrown in case of error.
+    template <class T>
+    void serialize(const T& value, ZResult* err = nullptr);
+
+    /// @brief Discard data serialized so far. The scratch buffer is kept.
+    void reset() {
+        _serializer = Serializer();
+        _head.reset();
+    }
+
+    /// @brief Finalize serialization and return the underlying `Bytes` object.
+    /// @return underlying `Bytes` object.
+    Bytes finish() && {
+        Bytes b = std::move(_serializer).finish();
+        if (!_head.has_value()) return b;
+        _head->append(std::move(b));
+        return std::move(*_head).finish();
+    }
+
+    /// @brief Finalize serialization and return the underlying `Bytes` object, leaving the serializer empty and ready
+    /// for the next message. The scratch buffer is kept.
+    /// @return underlying `Bytes` object.
+    Bytes finish() & {
+        Bytes b = std::move(_serializer).finish();
+        _serializer = Serializer();
+        if (!_head.has_value()) return b;
+        _head->append(std::move(b));
+        Bytes out = std::move(*_head).finish();
+        _head.reset();
+        return out;
+    }
+
+    /// @name Operators
+
+    /// @brief Get the serializer to which data is appended, e.g. to pass this object to custom serialization
+    /// functions taking a ``Serializer`` reference.
+    operator Serializer&() { return _serializer; }
+};
+
 /// @brief A Zenoh data deserializer used for incremental deserialization of several values.
 /// I.e. data produced by subsequent calls to `Serializer::serialize` can be read by corresponding calls to
 /// `Deserializer::deserialize` in the same order (or alternatively by a single call to `serialize`
@@ -87,11 +249,115 @@ class Deserializer : public Copyable<::ze_deserializer_t> {
     template <class T>
     T deserialize(zenoh::ZResult* err = nullptr);
 
+    /// @brief Deserialize next portion of data into an existing object. Standard containers are cleared and refilled,
+    /// reusing their already allocated storage (and that of their elements) where possible.
+    /// @param value object to deserialize into.
+    /// @param err if not null, the result code will be written to this location, otherwise ZException exception
+    /// will be thrown in case of error.
+    template <class T>
+    void deserialize_into(T& value, zenoh::ZResult* err = nullptr);
+
+    /// @brief Start lazy deserialization of a sequence (e.g. serialized from ``std::vector<T>``), whose elements are
+    /// then deserialized one at a time while iterating over returned range, without storing the whole sequence in
+    /// memory:
+    /// @code{.cpp}
+    /// for (auto& record: deserializer.deserialize_sequence<Record>()) {
+    ///     process(record);
+    /// }
+    /// @endcode
+    /// The sequence length is read immediately. Each element is read from this deserializer when the range iterator
+    /// advances, so the deserializer must outlive the range and should not be used for anything else until the
+    /// iteration is over. Once all elements are read, the deserializer can be used to read data serialized after
+    /// the sequence.
+    /// @tparam T element type.
+    /// @param err if not null, the result code will be written to this location, otherwise ZException exception
+    /// will be thrown in case of error. In case of error the iteration stops.
+    /// @return input range of sequence elements.
+    template <class T>
+    SequenceRange<T> deserialize_sequence(zenoh::ZResult* err = nullptr);
+
     /// @brief Checks if deserializer has parsed all the data.
     /// @return `true` if there is no more data to parse, `false` otherwise.
     bool is_done() const { return ::ze_deserializer_is_done(&this->_0); }
 };
 
+/// @brief A single-pass range of elements of a serialized sequence, returned by
+/// ``Deserializer::deserialize_sequence``. Elements are deserialized one by one as the range is iterated, reusing the
+/// storage of the previous element where possible.
+/// @tparam T element type.
+template <class T>
+class SequenceRange {
+    Deserializer* _deserializer;
+    size_t _remaining;
+    zenoh::ZResult* _err;
+    T _value{};
+    bool _has_value = false;
+
+    SequenceRange(Deserializer& deserializer, size_t len, zenoh::ZResult* err)
+        : _deserializer(&deserializer), _remaining(len), _err(err) {}
+
+    void advance();
+
+    friend class Deserializer;
+
+   public:
+    /// @brief Input iterator over the sequence elements.
+    class Iterator {
+        SequenceRange* _range = nullptr;
+
+        Iterator(SequenceRange* range) : _range(range) {}
+        friend class SequenceRange;
+
+       public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T*;
+        using reference = T&;
+
+        /// @name Constructors
+
+        /// @brief Construct an end iterator.
+        Iterator() = default;
+
+        /// @name Operators
+
+        /// @brief Access the current element. It can be moved from, the next element will be deserialized into it.
+        T& operator*() const { return _range->_value; }
+        /// @brief Access the current element.
+        T* operator->() const { return &_range->_value; }
+        /// @brief Deserialize the next element.
+        Iterator& operator++() {
+            _range->advance();
+            return *this;
+        }
+        /// @brief Deserialize the next element.
+        void operator++(int) { _range->advance(); }
+        /// @brief Compare iterators. An iterator compares equal to ``end()`` once all elements have been read, or
+        /// if an error occurred.
+        bool operator==(const Iterator& other) const { return done() == other.done(); }
+        /// @brief Compare iterators.
+        bool operator!=(const Iterator& other) const { return !(*this == other); }
+
+       private:
+        bool done() const { return _range == nullptr || !_range->_has_value; }
+    };
+
+    /// @name Methods
+
+    /// @brief Get an iterator to the first not yet read element. Should be called only once.
+    Iterator begin() {
+        if (!_has_value) advance();
+        return Iterator(this);
+    }
+
+    /// @brief Get the end iterator.
+    Iterator end() { return Iterator(nullptr); }
+
+    /// @brief Get the number of elements which have not been read yet.
+    size_t remaining() const { return _remaining; }
+};
+
 /// @brief Serialize a single value into `Bytes`.
 /// @param value value to serialize.
 /// @param err if not null, the result code will be written to this location, otherwise ZException exception
@@ -99,9 +365,37 @@ class Deserializer : public Copyable<::ze_deserializer_t> {
 /// @return 'Bytes' containing serialized value.
 template <class T>
 zenoh::Bytes serialize(const T& value, ZResult* err = nullptr) {
-    Serializer s;
-    s.serialize(value, err);
-    return std::move(s).finish();
+    if constexpr (detail::fixed_size<T>::value) {
+        return detail::serialize_fixed(value, err);
+    } else if constexpr (detail::bulk_sequence<T>::value) {
+        return detail::serialize_bulk_sequence(value, err);
+    } else {
+        BufferedSerializer s;
+        s.serialize(value, err);
+        return std::move(s).finish();
+    }
+}
+
+/// @brief Deserialize `Bytes` corresponding to a single serialized value into an existing object. Standard containers
+/// are cleared and refilled, reusing their already allocated storage (and that of their elements) where possible.
+/// @param bytes data to deserialize.
+/// @param value object to deserialize into.
+/// @param err if not null, the result code will be written to this location, otherwise ZException exception
+/// will be thrown in case of error.
+template <class T>
+void deserialize_into(const zenoh::Bytes& bytes, T& value, zenoh::ZResult* err = nullptr) {
+    if constexpr (detail::bulk_sequence<T>::value) {
+        detail::deserialize_bulk_sequence(bytes, value, err);
+    } else if constexpr (detail::fixed_size<T>::value) {
+        detail::deserialize_fixed(bytes, value, err);
+    } else {
+        Deserializer d(bytes);
+        d.deserialize_into(value, err);
+        if (!d.is_done() && (err == nullptr || *err == Z_OK)) {
+            __ZENOH_RESULT_CHECK(Z_EDESERIALIZE, err,
+                                 "Payload contains more bytes than required for deserialization");
+        }
+    }
 }
 
 /// @brief Deserialize `Bytes` corresponding to a single serialized value.
@@ -111,20 +405,20 @@ zenoh::Bytes serialize(const T& value, ZResult* err = nullptr) {
 /// @return deserialized value.
 template <class T>
 T deserialize(const zenoh::Bytes& bytes, zenoh::ZResult* err = nullptr) {
-    Deserializer d(bytes);
-    T t = d.deserialize<T>(err);
-    if (!d.is_done() && (err == nullptr || *err == Z_OK)) {
-        __ZENOH_RESULT_CHECK(Z_EDESERIALIZE, err, "Payload contains more bytes than required for deserialization");
-    }
+    T t{};
+    deserialize_into(bytes, t, err);
     return t;
 }
 
 namespace detail {
-template <class T>
-bool serialize_with_serializer(zenoh::ext::Serializer& serializer, const T& t, ZResult* err = nullptr);
+template <class S, class T>
+bool serialize_with_serializer(S& serializer, const T& t, ZResult* err = nullptr);
 template <class T>
 bool deserialize_with_deserializer(zenoh::ext::Deserializer& deserializer, T& t, ZResult* err = nullptr);
 
+/// Get the loaned zenoh-c serializer to which data is currently appended.
+inline auto* loaned_serializer(Serializer& serializer) { return interop::as_loaned_c_ptr(serializer); }
+
 #define __ZENOH_SERIALIZE_ARITHMETIC(TYPE, EXT)                                                                    \
     inline bool __zenoh_serialize_with_serializer(zenoh::ext::Serializer& serializer, TYPE t, ZResult* err) {      \
         __ZENOH_RESULT_CHECK(::ze_serializer_serialize_##EXT(zenoh::interop::as_loaned_c_ptr(serializer), t), err, \
@@ -162,9 +456,8 @@ inline bool __zenoh_serialize_with_serializer(zenoh::ext::Serializer& serializer
     return __zenoh_serialize_with_serializer(serializer, std::string_view(value), err);
 }
 
-template <class... Types>
-bool __zenoh_serialize_with_serializer(zenoh::ext::Serializer& serializer, const std::tuple<Types...>& value,
-                                       ZResult* err) {
+template <class S, class... Types>
+bool __zenoh_serialize_with_serializer(S& serializer, const std::tuple<Types...>& value, ZResult* err) {
     return std::apply(
         [&serializer, err](const auto&... v) {
             bool res = true;
@@ -174,16 +467,15 @@ bool __zenoh_serialize_with_serializer(zenoh::ext::Serializer& serializer, const
         value);
 }
 
-template <class X, class Y>
-bool __zenoh_serialize_with_serializer(zenoh::ext::Serializer& serializer, const std::pair<X, Y>& value, ZResult* err) {
+template <class S, class X, class Y>
+bool __zenoh_serialize_with_serializer(S& serializer, const std::pair<X, Y>& value, ZResult* err) {
     return serialize_with_serializer(serializer, value.first, err) &&
            serialize_with_serializer(serializer, value.second, err);
 }
 
-template <class It>
-bool __serialize_sequence_with_serializer(zenoh::ext::Serializer& serializer, It begin, It end, size_t n,
-                                          ZResult* err) {
-    __ZENOH_RESULT_CHECK(::ze_serializer_serialize_sequence_length(zenoh::interop::as_loaned_c_ptr(serializer), n), err,
+template <class S, class It>
+bool __serialize_sequence_with_serializer(S& serializer, It begin, It end, size_t n, ZResult* err) {
+    __ZENOH_RESULT_CHECK(::ze_serializer_serialize_sequence_length(loaned_serializer(serializer), n), err,
                          "Failed to serialize sequence length");
     if (err != nullptr && *err != Z_OK) {
         return false;
@@ -197,57 +489,302 @@ bool __serialize_sequence_with_serializer(zenoh::ext::Serializer& serializer, It
     return true;
 }
 
-template <class T, class Allocator>
-bool __zenoh_serialize_with_serializer(zenoh::ext::Serializer& serializer, const std::vector<T, Allocator>& value,
-                                       ZResult* err) {
-    return __serialize_sequence_with_serializer(serializer, value.begin(), value.end(), value.size(), err);
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+inline constexpr bool native_little_endian = false;
+#else
+inline constexpr bool native_little_endian = true;
+#endif
+
+/// Copy n values of type T from src to dst (which might be equal), reversing the byte order of each value.
+template <class T>
+void copy_byteswapped(const uint8_t* src, uint8_t* dst, size_t n) {
+    uint8_t tmp[sizeof(T)];
+    for (size_t i = 0; i < n; i++, src += sizeof(T), dst += sizeof(T)) {
+        std::memcpy(tmp, src, sizeof(T));
+        for (size_t j = 0; j < sizeof(T); j++) dst[j] = tmp[sizeof(T) - 1 - j];
+    }
 }
 
-template <class T, class Allocator>
-bool __zenoh_serialize_with_serializer(zenoh::ext::Serializer& serializer, const std::deque<T, Allocator>& value,
-                                       ZResult* err) {
-    return __serialize_sequence_with_serializer(serializer, value.begin(), value.end(), value.size(), err);
+/// Minimal size of blocks written raw by ``BufferedSerializer``. Each raw block ends the current zenoh serializer and
+/// appends a new segment to the output, so shorter sequences are cheaper to write value by value.
+inline constexpr size_t min_raw_block_size = 256;
+
+struct SerializerAccess {
+    static void write_raw(BufferedSerializer& serializer, const uint8_t* data, size_t len, ZResult* err) {
+        serializer.write_raw(data, len, err);
+    }
+
+    static uint8_t* scratch(BufferedSerializer& serializer, size_t len) { return serializer.scratch(len); }
+};
+
+template <class T, class = void>
+struct has_fields : std::false_type {};
+
+template <class T>
+struct has_fields<T, std::void_t<decltype(std::declval<T&>().__zenoh_fields())>> : std::true_type {};
+
+template <class T>
+using fields_tuple_t = decltype(std::declval<const T&>().__zenoh_fields());
+
+inline constexpr size_t leb128_size(uint64_t v) {
+    size_t n = 1;
+    for (; v >= 0x80; v >>= 7) n++;
+    return n;
 }
 
-template <class K, class H, class E, class Allocator>
-bool __zenoh_serialize_with_serializer(zenoh::ext::Serializer& serializer,
-                                       const std::unordered_set<K, H, E, Allocator>& value, ZResult* err) {
+inline uint8_t* write_leb128(uint64_t v, uint8_t* out) {
+    for (; v >= 0x80; v >>= 7) *out++ = static_cast<uint8_t>(v | 0x80);
+    *out++ = static_cast<uint8_t>(v);
+    return out;
+}
+
+/// Compile-time size of the serialized representation of types whose size does not depend on their value: arithmetic
+/// types, arrays, tuples, pairs and structs with serializable fields composed of them.
+template <class T, class>
+struct fixed_size {
+    static constexpr bool value = false;
+    static constexpr size_t size = 0;
+};
+
+template <class T>
+struct fixed_size<T, std::enable_if_t<is_bulk_serializable_v<T> || std::is_same_v<T, bool>>> {
+    static constexpr bool value = true;
+    static constexpr size_t size = sizeof(T);
+};
+
+template <class T, size_t N>
+struct fixed_size<std::array<T, N>> {
+    static constexpr bool value = fixed_size<T>::value;
+    static constexpr size_t size = leb128_size(N) + N * fixed_size<T>::size;
+};
+
+template <class... Types>
+struct fixed_size<std::tuple<Types...>> {
+    static constexpr bool value = (fixed_size<std::remove_cv_t<std::remove_reference_t<Types>>>::value && ...);
+    static constexpr size_t size = (fixed_size<std::remove_cv_t<std::remove_reference_t<Types>>>::size + ... + 0);
+};
+
+template <class X, class Y>
+struct fixed_size<std::pair<X, Y>> : fixed_size<std::tuple<X, Y>> {};
+
+template <class T>
+struct fixed_size<T, std::enable_if_t<has_fields<T>::value>> : fixed_size<fields_tuple_t<T>> {};
+
+template <class... Types>
+uint8_t* encode_fixed_composite(const std::tuple<Types...>& value, uint8_t* out);
+template <class X, class Y>
+uint8_t* encode_fixed_composite(const std::pair<X, Y>& value, uint8_t* out);
+template <class T, size_t N>
+uint8_t* encode_fixed_composite(const std::array<T, N>& value, uint8_t* out);
+template <class... Types>
+const uint8_t* decode_fixed_composite(const uint8_t* in, std::tuple<Types...>& value);
+template <class X, class Y>
+const uint8_t* decode_fixed_composite(const uint8_t* in, std::pair<X, Y>& value);
+template <class T, size_t N>
+const uint8_t* decode_fixed_composite(const uint8_t* in, std::array<T, N>& value);
+
+/// Write serialized representation of a value of fixed size type into `out`, and return pointer past its end.
+template <class T>
+uint8_t* encode_fixed(const T& value, uint8_t* out) {
+    if constexpr (std::is_same_v<T, bool>) {
+        *out = value ? 1 : 0;
+        return out + 1;
+    } else if constexpr (is_bulk_serializable_v<T>) {
+        if constexpr (native_little_endian) {
+            std::memcpy(out, &value, sizeof(T));
+        } else {
+            copy_byteswapped<T>(reinterpret_cast<const uint8_t*>(&value), out, 1);
+        }
+        return out + sizeof(T);
+    } else if constexpr (has_fields<T>::value) {
+        return encode_fixed(value.__zenoh_fields(), out);
+    } else {
+        return encode_fixed_composite(value, out);
+    }
+}
+
+template <class... Types>
+uint8_t* encode_fixed_composite(const std::tuple<Types...>& value, uint8_t* out) {
+    std::apply([&out](const auto&... v) { ((out = encode_fixed(v, out)), ...); }, value);
+    return out;
+}
+
+template <class X, class Y>
+uint8_t* encode_fixed_composite(const std::pair<X, Y>& value, uint8_t* out) {
+    return encode_fixed(value.second, encode_fixed(value.first, out));
+}
+
+template <class T, size_t N>
+uint8_t* encode_fixed_composite(const std::array<T, N>& value, uint8_t* out) {
+    out = write_leb128(N, out);
+    for (const auto& v : value) out = encode_fixed(v, out);
+    return out;
+}
+
+/// Read value of fixed size type from its serialized representation in `in`, and return pointer past its end, or
+/// `nullptr` if the data is invalid.
+template <class T>
+const uint8_t* decode_fixed(const uint8_t* in, T& value) {
+    if constexpr (std::is_same_v<T, bool>) {
+        if (*in > 1) return nullptr;
+        value = (*in == 1);
+        return in + 1;
+    } else if constexpr (is_bulk_serializable_v<T>) {
+        if constexpr (native_little_endian) {
+            std::memcpy(&value, in, sizeof(T));
+        } else {
+            copy_byteswapped<T>(in, reinterpret_cast<uint8_t*>(&value), 1);
+        }
+        return in + sizeof(T);
+    } else if constexpr (has_fields<T>::value) {
+        auto fields = value.__zenoh_fields();
+        return decode_fixed_composite(in, fields);
+    } else {
+        return decode_fixed_composite(in, value);
+    }
+}
+
+template <class... Types>
+const uint8_t* decode_fixed_composite(const uint8_t* in, std::tuple<Types...>& value) {
+    std::apply([&in](auto&... v) { ((in = (in != nullptr) ? decode_fixed(in, v) : nullptr), ...); }, value);
+    return in;
+}
+
+template <class X, class Y>
+const uint8_t* decode_fixed_composite(const uint8_t* in, std::pair<X, Y>& value) {
+    in = decode_fixed(in, value.first);
+    return in != nullptr ? decode_fixed(in, value.second) : nullptr;
+}
+
+template <class T, size_t N>
+const uint8_t* decode_fixed_composite(const uint8_t* in, std::array<T, N>& value) {
+    uint8_t len[leb128_size(N)];
+    write_leb128(N, len);
+    if (std::memcmp(in, len, sizeof(len)) != 0) return nullptr;
+    in += sizeof(len);
+    for (size_t i = 0; i < N && in != nullptr; i++) in = decode_fixed(in, value[i]);
+    return in;
+}
+
+/// Serialize sequence of arithmetic values, as a single block if the serializer supports raw writes and the sequence
+/// is long enough.
+template <class S, class T>
+bool __serialize_arithmetic_sequence_with_serializer(S& serializer, const T* data, size_t n, ZResult* err) {
+    if constexpr (sizeof(T) == 1) {
+        // a buffer is serialized as its length followed by its bytes, which matches the sequence format
+        __ZENOH_RESULT_CHECK(
+            ::ze_serializer_serialize_buf(loaned_serializer(serializer), reinterpret_cast<const uint8_t*>(data), n),
+            err, "Failed to serialize sequence");
+        return err == nullptr || *err == Z_OK;
+    } else {
+        if constexpr (std::is_same_v<S, BufferedSerializer>) {
+            if (n * sizeof(T) >= min_raw_block_size) {
+                __ZENOH_RESULT_CHECK(::ze_serializer_serialize_sequence_length(loaned_serializer(serializer), n), err,
+                                     "Failed to serialize sequence length");
+                if (err != nullptr && *err != Z_OK) return false;
+                const uint8_t* block = reinterpret_cast<const uint8_t*>(data);
+                if constexpr (!native_little_endian) {
+                    uint8_t* buf = SerializerAccess::scratch(serializer, n * sizeof(T));
+                    copy_byteswapped<T>(block, buf, n);
+                    block = buf;
+                }
+                SerializerAccess::write_raw(serializer, block, n * sizeof(T), err);
+                return err == nullptr || *err == Z_OK;
+            }
+        }
+        return __serialize_sequence_with_serializer(serializer, data, data + n, n, err);
+    }
+}
+
+/// Serialize sequence of fixed size values, encoded into the reusable serializer scratch buffer first if the
+/// serializer supports raw writes and the sequence is long enough.
+template <class S, class T>
+bool __serialize_fixed_sequence_with_serializer(S& serializer, const T* data, size_t n, ZResult* err) {
+    if constexpr (std::is_same_v<S, BufferedSerializer>) {
+        size_t len = n * fixed_size<T>::size;
+        if (len >= min_raw_block_size) {
+            __ZENOH_RESULT_CHECK(::ze_serializer_serialize_sequence_length(loaned_serializer(serializer), n), err,
+                                 "Failed to serialize sequence length");
+            if (err != nullptr && *err != Z_OK) return false;
+            uint8_t* buf = SerializerAccess::scratch(serializer, len);
+            uint8_t* out = buf;
+            for (size_t i = 0; i < n; i++) out = encode_fixed(data[i], out);
+            SerializerAccess::write_raw(serializer, buf, len, err);
+            return err == nullptr || *err == Z_OK;
+        }
+    }
+    return __serialize_sequence_with_serializer(serializer, data, data + n, n, err);
+}
+
+template <class S, class T, class Allocator>
+bool __zenoh_serialize_with_serializer(S& serializer, const std::vector<T, Allocator>& value, ZResult* err) {
+    if constexpr (is_bulk_serializable_v<T>) {
+        return __serialize_arithmetic_sequence_with_serializer(serializer, value.data(), value.size(), err);
+    } else if constexpr (fixed_size<T>::value && !std::is_same_v<T, bool>) {  // vector<bool> has no data()
+        return __serialize_fixed_sequence_with_serializer(serializer, value.data(), value.size(), err);
+    } else {
+        return __serialize_sequence_with_serializer(serializer, value.begin(), value.end(), value.size(), err);
+    }
+}
+
+template <class S, class T, class Allocator>
+bool __zenoh_serialize_with_serializer(S& serializer, const std::deque<T, Allocator>& value, ZResult* err) {
     return __serialize_sequence_with_serializer(serializer, value.begin(), value.end(), value.size(), err);
 }
 
-template <class K, class Compare, class Allocator>
-bool __zenoh_serialize_with_serializer(zenoh::ext::Serializer& serializer, const std::set<K, Compare, Allocator>& value,
+template <class S, class K, class H, class E, class Allocator>
+bool __zenoh_serialize_with_serializer(S& serializer, const std::unordered_set<K, H, E, Allocator>& value,
                                        ZResult* err) {
     return __serialize_sequence_with_serializer(serializer, value.begin(), value.end(), value.size(), err);
 }
 
-template <class K, class V, class H, class E, class Allocator>
-bool __zenoh_serialize_with_serializer(zenoh::ext::Serializer& serializer,
-                                       const std::unordered_map<K, V, H, E, Allocator>& value, ZResult* err) {
+template <class S, class K, class Compare, class Allocator>
+bool __zenoh_serialize_with_serializer(S& serializer, const std::set<K, Compare, Allocator>& value, ZResult* err) {
     return __serialize_sequence_with_serializer(serializer, value.begin(), value.end(), value.size(), err);
 }
 
-template <class K, class V, class Compare, class Allocator>
-bool __zenoh_serialize_with_serializer(zenoh::ext::Serializer& serializer,
-                                       const std::map<K, V, Compare, Allocator>& value, ZResult* err) {
+template <class S, class K, class V, class H, class E, class Allocator>
+bool __zenoh_serialize_with_serializer(S& serializer, const std::unordered_map<K, V, H, E, Allocator>& value,
+                                       ZResult* err) {
     return __serialize_sequence_with_serializer(serializer, value.begin(), value.end(), value.size(), err);
 }
 
-template <class T, size_t N>
-bool __zenoh_serialize_with_serializer(zenoh::ext::Serializer& serializer, const std::array<T, N>& value,
-                                       ZResult* err) {
+template <class S, class K, class V, class Compare, class Allocator>
+bool __zenoh_serialize_with_serializer(S& serializer, const std::map<K, V, Compare, Allocator>& value, ZResult* err) {
     return __serialize_sequence_with_serializer(serializer, value.begin(), value.end(), value.size(), err);
 }
 
+template <class S, class T, size_t N>
+bool __zenoh_serialize_with_serializer(S& serializer, const std::array<T, N>& value, ZResult* err) {
+    if constexpr (is_bulk_serializable_v<T>) {
+        return __serialize_arithmetic_sequence_with_serializer(serializer, value.data(), value.size(), err);
+    } else if constexpr (fixed_size<T>::value) {
+        return __serialize_fixed_sequence_with_serializer(serializer, value.data(), value.size(), err);
+    } else {
+        return __serialize_sequence_with_serializer(serializer, value.begin(), value.end(), value.size(), err);
+    }
+}
+
 #if __cplusplus >= 202002L
-template <class T, std::size_t Extent>
-bool __zenoh_serialize_with_serializer(zenoh::ext::Serializer& serializer, std::span<T, Extent> value, ZResult* err) {
-    return __serialize_sequence_with_serializer(serializer, value.begin(), value.end(), value.size(), err);
+template <class S, class T, std::size_t Extent>
+bool __zenoh_serialize_with_serializer(S& serializer, std::span<T, Extent> value, ZResult* err) {
+    if constexpr (is_bulk_serializable_v<std::remove_cv_t<T>>) {
+        return __serialize_arithmetic_sequence_with_serializer(serializer, value.data(), value.size(), err);
+    } else if constexpr (fixed_size<std::remove_cv_t<T>>::value) {
+        return __serialize_fixed_sequence_with_serializer(serializer, value.data(), value.size(), err);
+    } else {
+        return __serialize_sequence_with_serializer(serializer, value.begin(), value.end(), value.size(), err);
+    }
 }
 #endif
 
-template <class T>
-bool serialize_with_serializer(zenoh::ext::Serializer& serializer, const T& t, ZResult* err) {
+template <class S, class T, std::enable_if_t<has_fields<T>::value, int> = 0>
+bool __zenoh_serialize_with_serializer(S& serializer, const T& value, ZResult* err) {
+    return __zenoh_serialize_with_serializer(serializer, value.__zenoh_fields(), err);
+}
+
+template <class S, class T>
+bool serialize_with_serializer(S& serializer, const T& t, ZResult* err) {
     return __zenoh_serialize_with_serializer(serializer, t, err);
 }
 
@@ -277,7 +814,7 @@ inline bool __zenoh_deserialize_with_deserializer(zenoh::ext::Deserializer& dese
     z_owned_string_t s;
     __ZENOH_RESULT_CHECK(::ze_deserializer_deserialize_string(interop::as_copyable_c_ptr(deserializer), &s), err,
                          "Deserialization failure");
-    value = std::string(::z_string_data(::z_loan(s)), ::z_string_len(::z_loan(s)));
+    value.assign(::z_string_data(::z_loan(s)), ::z_string_len(::z_loan(s)));
     ::z_drop(::z_move(s));
     return err == nullptr || *err == Z_OK;
 }
@@ -310,101 +847,258 @@ bool __zenoh_deserialize_with_deserializer(zenoh::ext::Deserializer& deserialize
 
 #define _ZENOH_DESERIALIZE_SEQUENCE_END return (err == nullptr || *err == Z_OK);
 
+/// Deserialize sequence of single byte values, serialized as a buffer, and pass its data to `f`.
+template <class F>
+bool __deserialize_byte_sequence_with_deserializer(zenoh::ext::Deserializer& deserializer, F&& f,
+                                                   zenoh::ZResult* err) {
+    ::z_owned_slice_t s;
+    __ZENOH_RESULT_CHECK(::ze_deserializer_deserialize_slice(interop::as_copyable_c_ptr(deserializer), &s), err,
+                         "Deserialization failure");
+    if (err != nullptr && *err != Z_OK) return false;
+    bool res = f(::z_slice_data(::z_loan(s)), ::z_slice_len(::z_loan(s)));
+    ::z_drop(::z_move(s));
+    return res;
+}
+
 template <class T, class Allocator>
 bool __zenoh_deserialize_with_deserializer(zenoh::ext::Deserializer& deserializer, std::vector<T, Allocator>& value,
                                            zenoh::ZResult* err) {
-    _ZENOH_DESERIALIZE_SEQUENCE_BEGIN
-    value.reserve(value.size() + len);
-    for (size_t i = 0; i < len; ++i) {
-        T v;
-        if (!deserialize_with_deserializer(deserializer, v, err)) return false;
-        value.push_back(std::move(v));
+    if constexpr (is_bulk_serializable_v<T> && sizeof(T) == 1) {
+        return __deserialize_byte_sequence_with_deserializer(
+            deserializer,
+            [&value](const uint8_t* data, size_t len) {
+                value.resize(len);
+                std::memcpy(value.data(), data, len);
+                return true;
+            },
+            err);
+    } else {
+        _ZENOH_DESERIALIZE_SEQUENCE_BEGIN
+        value.resize(len);
+        for (size_t i = 0; i < len; ++i) {
+            if constexpr (std::is_same_v<T, bool>) {
+                bool v;
+                if (!deserialize_with_deserializer(deserializer, v, err)) return false;
+                value[i] = v;
+            } else {
+                if (!deserialize_with_deserializer(deserializer, value[i], err)) return false;
+            }
+        }
+        _ZENOH_DESERIALIZE_SEQUENCE_END
     }
-    _ZENOH_DESERIALIZE_SEQUENCE_END
 }
 
 template <class T, size_t N>
 bool __zenoh_deserialize_with_deserializer(zenoh::ext::Deserializer& deserializer, std::array<T, N>& value,
                                            zenoh::ZResult* err) {
-    _ZENOH_DESERIALIZE_SEQUENCE_BEGIN
-    if (len != N && (err == nullptr || *err == Z_OK)) {
-        __ZENOH_RESULT_CHECK(Z_EDESERIALIZE, err, "Incorrect sequence size");
-        return false;
-    }
-    for (size_t i = 0; i < len; ++i) {
-        if (!deserialize_with_deserializer(deserializer, value[i], err)) return false;
+    if constexpr (is_bulk_serializable_v<T> && sizeof(T) == 1) {
+        return __deserialize_byte_sequence_with_deserializer(
+            deserializer,
+            [&value, err](const uint8_t* data, size_t len) {
+                if (len != N) {
+                    __ZENOH_RESULT_CHECK(Z_EDESERIALIZE, err, "Incorrect sequence size");
+                    return false;
+                }
+                std::memcpy(value.data(), data, len);
+                return true;
+            },
+            err);
+    } else {
+        _ZENOH_DESERIALIZE_SEQUENCE_BEGIN
+        if (len != N && (err == nullptr || *err == Z_OK)) {
+            __ZENOH_RESULT_CHECK(Z_EDESERIALIZE, err, "Incorrect sequence size");
+            return false;
+        }
+        for (size_t i = 0; i < len; ++i) {
+            if (!deserialize_with_deserializer(deserializer, value[i], err)) return false;
+        }
+        _ZENOH_DESERIALIZE_SEQUENCE_END
     }
-    _ZENOH_DESERIALIZE_SEQUENCE_END
 }
 
 template <class T, class Allocator>
 bool __zenoh_deserialize_with_deserializer(zenoh::ext::Deserializer& deserializer, std::deque<T, Allocator>& value,
                                            zenoh::ZResult* err) {
     _ZENOH_DESERIALIZE_SEQUENCE_BEGIN
+    value.resize(len);
     for (size_t i = 0; i < len; ++i) {
-        T v;
-        if (!deserialize_with_deserializer(deserializer, v, err)) return false;
-        value.push_back(std::move(v));
+        if (!deserialize_with_deserializer(deserializer, value[i], err)) return false;
     }
     _ZENOH_DESERIALIZE_SEQUENCE_END
 }
 
-template <class K, class H, class E, class Allocator>
-bool __zenoh_deserialize_with_deserializer(zenoh::ext::Deserializer& deserializer,
-                                           std::unordered_set<K, H, E, Allocator>& value, zenoh::ZResult* err) {
+/// Deserialize set or map, reusing the nodes (and the storage of keys and values) of its current elements.
+template <bool Unordered, class Container>
+bool __deserialize_node_container_with_deserializer(zenoh::ext::Deserializer& deserializer, Container& value,
+                                                    zenoh::ZResult* err) {
+    constexpr bool is_map = !std::is_same_v<typename Container::key_type, typename Container::value_type>;
+    auto read_node = [&deserializer, err](auto& node) {
+        if constexpr (is_map) {
+            return deserialize_with_deserializer(deserializer, node.key(), err) &&
+                   deserialize_with_deserializer(deserializer, node.mapped(), err);
+        } else {
+            return deserialize_with_deserializer(deserializer, node.value(), err);
+        }
+    };
     _ZENOH_DESERIALIZE_SEQUENCE_BEGIN
+    Container spare;
+    spare.swap(value);
+    if constexpr (Unordered) {
+        value.reserve(len);
+    }
     for (size_t i = 0; i < len; ++i) {
-        K v;
-        if (!deserialize_with_deserializer(deserializer, v, err)) return false;
-        value.insert(std::move(v));
+        if (!spare.empty()) {
+            auto node = spare.extract(spare.begin());
+            if (!read_node(node)) return false;
+            value.insert(std::move(node));
+        } else if constexpr (is_map) {
+            std::pair<typename Container::key_type, typename Container::mapped_type> v;
+            if (!deserialize_with_deserializer(deserializer, v, err)) return false;
+            value.insert(std::move(v));
+        } else {
+            typename Container::key_type v;
+            if (!deserialize_with_deserializer(deserializer, v, err)) return false;
+            value.insert(std::move(v));
+        }
     }
     _ZENOH_DESERIALIZE_SEQUENCE_END
 }
 
+template <class K, class H, class E, class Allocator>
+bool __zenoh_deserialize_with_deserializer(zenoh::ext::Deserializer& deserializer,
+                                           std::unordered_set<K, H, E, Allocator>& value, zenoh::ZResult* err) {
+    return __deserialize_node_container_with_deserializer<true>(deserializer, value, err);
+}
+
 template <class K, class Compare, class Allocator>
 bool __zenoh_deserialize_with_deserializer(zenoh::ext::Deserializer& deserializer,
                                            std::set<K, Compare, Allocator>& value, zenoh::ZResult* err) {
-    _ZENOH_DESERIALIZE_SEQUENCE_BEGIN
-    for (size_t i = 0; i < len; ++i) {
-        K v;
-        if (!deserialize_with_deserializer(deserializer, v, err)) return false;
-        value.insert(std::move(v));
-    }
-    _ZENOH_DESERIALIZE_SEQUENCE_END
+    return __deserialize_node_container_with_deserializer<false>(deserializer, value, err);
 }
 
 template <class K, class V, class H, class E, class Allocator>
 bool __zenoh_deserialize_with_deserializer(zenoh::ext::Deserializer& deserializer,
                                            std::unordered_map<K, V, H, E, Allocator>& value, zenoh::ZResult* err) {
-    _ZENOH_DESERIALIZE_SEQUENCE_BEGIN
-    for (size_t i = 0; i < len; ++i) {
-        std::pair<K, V> v;
-        if (!deserialize_with_deserializer(deserializer, v, err)) return false;
-        value.insert(std::move(v));
-    }
-    _ZENOH_DESERIALIZE_SEQUENCE_END
+    return __deserialize_node_container_with_deserializer<true>(deserializer, value, err);
 }
 
 template <class K, class V, class Compare, class Allocator>
 bool __zenoh_deserialize_with_deserializer(zenoh::ext::Deserializer& deserializer,
                                            std::map<K, V, Compare, Allocator>& value, zenoh::ZResult* err) {
-    _ZENOH_DESERIALIZE_SEQUENCE_BEGIN
-    for (size_t i = 0; i < len; ++i) {
-        std::pair<K, V> v;
-        if (!deserialize_with_deserializer(deserializer, v, err)) return false;
-        value.insert(std::move(v));
-    }
-    _ZENOH_DESERIALIZE_SEQUENCE_END
+    return __deserialize_node_container_with_deserializer<false>(deserializer, value, err);
 }
 
 #undef _ZENOH_DESERIALIZE_SEQUENCE_BEGIN
 #undef _ZENOH_DESERIALIZE_SEQUENCE_END
 
+template <class T, std::enable_if_t<has_fields<T>::value, int> = 0>
+bool __zenoh_deserialize_with_deserializer(zenoh::ext::Deserializer& deserializer, T& value, zenoh::ZResult* err) {
+    auto fields = value.__zenoh_fields();
+    return __zenoh_deserialize_with_deserializer(deserializer, fields, err);
+}
+
 template <class T>
 bool deserialize_with_deserializer(zenoh::ext::Deserializer& deserializer, T& t, ZResult* err) {
     return __zenoh_deserialize_with_deserializer(deserializer, t, err);
 }
 
+/// Read LEB128-encoded sequence length.
+inline bool read_sequence_length(Bytes::Reader& reader, size_t& len) {
+    uint64_t v = 0;
+    for (size_t shift = 0; shift < 64; shift += 7) {
+        uint8_t b;
+        if (reader.read(&b, 1) != 1) return false;
+        v |= static_cast<uint64_t>(b & 0x7f) << shift;
+        if ((b & 0x80) == 0) {
+            len = static_cast<size_t>(v);
+            return true;
+        }
+    }
+    return false;
+}
+
+/// Deserialize payload containing a single sequence of arithmetic values, reading all values as a single block.
+template <class T>
+bool deserialize_bulk_sequence(const Bytes& bytes, T& value, ZResult* err) {
+    using V = typename T::value_type;
+    Bytes::Reader reader = bytes.reader();
+    size_t len;
+    if (!read_sequence_length(reader, len) || len > reader.remaining() / sizeof(V)) {
+        __ZENOH_RESULT_CHECK(Z_EDESERIALIZE, err, "Deserialization failure");
+        return false;
+    }
+    if constexpr (bulk_sequence<T>::fixed_size) {
+        if (len != value.size()) {
+            __ZENOH_RESULT_CHECK(Z_EDESERIALIZE, err, "Incorrect sequence size");
+            return false;
+        }
+    } else {
+        value.resize(len);
+    }
+    uint8_t* data = reinterpret_cast<uint8_t*>(value.data());
+    reader.read(data, len * sizeof(V));
+    if constexpr (!native_little_endian && sizeof(V) > 1) {
+        copy_byteswapped<V>(data, data, len);
+    }
+    if (reader.remaining() != 0) {
+        __ZENOH_RESULT_CHECK(Z_EDESERIALIZE, err, "Payload contains more bytes than required for deserialization");
+        return false;
+    }
+    return true;
+}
+
+/// Serialize payload containing a single sequence of arithmetic values into an exactly sized buffer.
+template <class T>
+zenoh::Bytes serialize_bulk_sequence(const T& value, ZResult* err) {
+    using V = typename T::value_type;
+    if (err != nullptr) *err = Z_OK;
+    std::vector<uint8_t> buf(leb128_size(value.size()) + value.size() * sizeof(V));
+    uint8_t* data = write_leb128(value.size(), buf.data());
+    if (value.empty()) return Bytes(std::move(buf));
+    if constexpr (native_little_endian || sizeof(V) == 1) {
+        std::memcpy(data, value.data(), value.size() * sizeof(V));
+    } else {
+        copy_byteswapped<V>(reinterpret_cast<const uint8_t*>(value.data()), data, value.size());
+    }
+    return Bytes(std::move(buf));
+}
+
+/// Serialize value of fixed size type into an exactly sized buffer.
+template <class T>
+zenoh::Bytes serialize_fixed(const T& value, ZResult* err) {
+    if (err != nullptr) *err = Z_OK;
+    std::vector<uint8_t> buf(fixed_size<T>::size);
+    encode_fixed(value, buf.data());
+    return Bytes(std::move(buf));
+}
+
+/// Deserialize payload containing a single value of fixed size type, decoding it directly from payload memory if
+/// it is contiguous.
+template <class T>
+bool deserialize_fixed(const Bytes& bytes, T& value, ZResult* err) {
+    constexpr size_t size = fixed_size<T>::size;
+    if (bytes.size() != size) {
+        __ZENOH_RESULT_CHECK(Z_EDESERIALIZE, err,
+                             bytes.size() < size ? "Deserialization failure"
+                                                 : "Payload contains more bytes than required for deserialization");
+        return false;
+    }
+    uint8_t buf[size > 0 ? size : 1];
+    const uint8_t* data = buf;
+    auto it = bytes.slice_iter();
+    auto slice = it.next();
+    if (slice.has_value() && slice->len == size) {
+        data = slice->data;
+    } else {
+        bytes.reader().read(buf, size);
+    }
+    if (decode_fixed(data, value) == nullptr) {
+        __ZENOH_RESULT_CHECK(Z_EDESERIALIZE, err, "Deserialization failure");
+        return false;
+    }
+    return true;
+}
+
 }  // namespace detail
 
 template <class T>
@@ -412,6 +1106,11 @@ void Serializer::serialize(const T& value, ZResult* err) {
     detail::serialize_with_serializer(*this, value, err);
 }
 
+template <class T>
+void BufferedSerializer::serialize(const T& value, ZResult* err) {
+    detail::serialize_with_serializer(*this, value, err);
+}
+
 template <class T>
 T Deserializer::deserialize(zenoh::ZResult* err) {
     T t;
@@ -419,5 +1118,233 @@ T Deserializer::deserialize(zenoh::ZResult* err) {
     return t;
 }
 
+template <class T>
+void Deserializer::deserialize_into(T& value, zenoh::ZResult* err) {
+    detail::deserialize_with_deserializer(*this, value, err);
+}
+
+template <class T>
+SequenceRange<T> Deserializer::deserialize_sequence(zenoh::ZResult* err) {
+    size_t len = 0;
+    __ZENOH_RESULT_CHECK(::ze_deserializer_deserialize_sequence_length(interop::as_copyable_c_ptr(*this), &len), err,
+                         "Deserialization failure:: Failed to read sequence length");
+    if (err != nullptr && *err != Z_OK) len = 0;
+    return SequenceRange<T>(*this, len, err);
+}
+
+template <class T>
+void SequenceRange<T>::advance() {
+    _has_value = false;
+    if (_remaining == 0) return;
+    _remaining--;
+    if (detail::deserialize_with_deserializer(*_deserializer, _value, _err)) {
+        _has_value = true;
+    } else {
+        _remaining = 0;
+    }
+}
+
+namespace detail {
+template <class T>
+struct is_view_tuple : std::false_type {};
+
+template <class... Types>
+struct is_view_tuple<std::tuple<Types...>> : std::true_type {};
+
+template <class X, class Y>
+struct is_view_tuple<std::pair<X, Y>> : std::true_type {};
+
+#if __cplusplus >= 202002L
+template <class T>
+struct is_view_span : std::false_type {};
+
+template <class T>
+struct is_view_span<std::span<const T>> : std::bool_constant<is_bulk_serializable_v<T>> {};
+#endif
+
+template <class T>
+inline constexpr bool always_false_v = false;
+
+/// Reader of serialized data stored in a single contiguous buffer.
+class ViewReader {
+    const uint8_t* _data;
+    size_t _len;
+    size_t _pos = 0;
+
+   public:
+    ViewReader(const uint8_t* data, size_t len) : _data(data), _len(len) {}
+
+    /// Return pointer to the next n bytes and advance past them, or nullptr if there is not enough data.
+    const uint8_t* take(size_t n) {
+        if (n > _len - _pos) return nullptr;
+        const uint8_t* p = _data + _pos;
+        _pos += n;
+        return p;
+    }
+
+    bool read_sequence_length(size_t& len) {
+        uint64_t v = 0;
+        for (size_t shift = 0; shift < 64; shift += 7) {
+            const uint8_t* b = take(1);
+            if (b == nullptr) return false;
+            v |= static_cast<uint64_t>(*b & 0x7f) << shift;
+            if ((*b & 0x80) == 0) {
+                len = static_cast<size_t>(v);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool is_done() const { return _pos == _len; }
+};
+
+/// Storage for the data that can not be borrowed from the serialized payload.
+struct ViewStorage {
+    /// Contiguous copy of the payload, if it is fragmented.
+    std::vector<uint8_t> payload;
+    /// Aligned (and byte-swapped on big-endian hosts) copies of sequences that can not be viewed in place.
+    std::vector<std::unique_ptr<std::max_align_t[]>> sequences;
+
+    const uint8_t* copy_sequence(const uint8_t* data, size_t n, size_t element_size) {
+        size_t len = n * element_size;
+        sequences.emplace_back(new std::max_align_t[(len + sizeof(std::max_align_t) - 1) / sizeof(std::max_align_t)]);
+        uint8_t* dst = reinterpret_cast<uint8_t*>(sequences.back().get());
+        std::memcpy(dst, data, len);
+        return dst;
+    }
+};
+
+template <class T>
+bool read_view(ViewReader& reader, ViewStorage& storage, T& value) {
+    (void)storage;
+    if constexpr (is_bulk_serializable_v<T>) {
+        const uint8_t* p = reader.take(sizeof(T));
+        if (p == nullptr) return false;
+        if constexpr (native_little_endian) {
+            std::memcpy(&value, p, sizeof(T));
+        } else {
+            copy_byteswapped<T>(p, reinterpret_cast<uint8_t*>(&value), 1);
+        }
+        return true;
+    } else if constexpr (std::is_same_v<T, bool>) {
+        const uint8_t* p = reader.take(1);
+        if (p == nullptr || *p > 1) return false;
+        value = *p != 0;
+        return true;
+    } else if constexpr (std::is_same_v<T, std::string_view>) {
+        size_t len;
+        if (!reader.read_sequence_length(len)) return false;
+        const uint8_t* p = reader.take(len);
+        if (p == nullptr) return false;
+        value = std::string_view(reinterpret_cast<const char*>(p), len);
+        return true;
+#if __cplusplus >= 202002L
+    } else if constexpr (is_view_span<T>::value) {
+        using V = typename T::value_type;
+        size_t len;
+        if (!reader.read_sequence_length(len) || len > SIZE_MAX / sizeof(V)) return false;
+        const uint8_t* p = reader.take(len * sizeof(V));
+        if (p == nullptr) return false;
+        bool aligned = reinterpret_cast<uintptr_t>(p) % alignof(V) == 0;
+        if (!aligned || (!native_little_endian && sizeof(V) > 1)) {
+            uint8_t* copy = const_cast<uint8_t*>(storage.copy_sequence(p, len, sizeof(V)));
+            if constexpr (!native_little_endian && sizeof(V) > 1) {
+                copy_byteswapped<V>(copy, copy, len);
+            }
+            p = copy;
+        }
+        value = T(reinterpret_cast<const V*>(p), len);
+        return true;
+#endif
+    } else if constexpr (is_view_tuple<T>::value) {
+        return std::apply([&reader, &storage](auto&... v) { return (read_view(reader, storage, v) && ...); }, value);
+    } else {
+        static_assert(always_false_v<T>,
+                      "Only arithmetic types, std::string_view, std::span<const T> of arithmetic T, and tuples/pairs "
+                      "of them can be deserialized as views");
+        return false;
+    }
+}
+}  // namespace detail
+
+template <class T>
+class DeserializedView;
+
+template <class T>
+DeserializedView<T> deserialize_view(const zenoh::Bytes& bytes, zenoh::ZResult* err = nullptr);
+
+/// @brief A value deserialized without copying, by ``deserialize_view``.
+///
+/// String and sequence views refer to the memory of the source ``Bytes`` object, which must outlive this object and
+/// all views obtained from it. If the source data is fragmented, or some sequence can not be referenced in place (due
+/// to alignment or byte order), the corresponding data is copied into a buffer owned by this object.
+/// @tparam T view type, one of arithmetic type, ``std::string_view``, ``std::span<const U>`` of arithmetic ``U`` (C++20
+/// only), or a ``std::tuple`` / ``std::pair`` of these types.
+template <class T>
+class DeserializedView {
+    detail::ViewStorage _storage;
+    T _value = {};
+
+    template <class U>
+    friend DeserializedView<U> deserialize_view(const zenoh::Bytes& bytes, zenoh::ZResult* err);
+
+    DeserializedView() = default;
+
+   public:
+    /// @name Constructors
+    DeserializedView(DeserializedView&&) = default;
+    DeserializedView(const DeserializedView&) = delete;
+
+    /// @name Operators
+    DeserializedView& operator=(DeserializedView&&) = default;
+    DeserializedView& operator=(const DeserializedView&) = delete;
+
+    /// @brief Access deserialized value.
+    const T& operator*() const { return _value; }
+
+    /// @brief Access deserialized value.
+    const T* operator->() const { return &_value; }
+
+    /// @name Methods
+
+    /// @brief Get deserialized value.
+    const T& get() const { return _value; }
+
+    /// @brief Check if all views refer to the source data, i.e. deserialization did not copy any data.
+    bool is_borrowed() const { return _storage.payload.empty() && _storage.sequences.empty(); }
+};
+
+/// @brief Deserialize `Bytes` corresponding to a single serialized value into views referring to the serialized data.
+/// Data is copied only if the payload is fragmented or if a sequence can not be referenced in place.
+/// @tparam T view type, see ``DeserializedView``.
+/// @param bytes data to deserialize, must outlive the returned object.
+/// @param err if not null, the result code will be written to this location, otherwise ZException exception
+/// will be thrown in case of error.
+/// @return deserialized value.
+template <class T>
+DeserializedView<T> deserialize_view(const zenoh::Bytes& bytes, zenoh::ZResult* err) {
+    DeserializedView<T> out;
+    const uint8_t* data = nullptr;
+    size_t len = bytes.size();
+    auto it = bytes.slice_iter();
+    auto slice = it.next();
+    if (slice.has_value() && slice->len == len) {
+        data = slice->data;
+    } else if (len > 0) {
+        out._storage.payload = bytes.as_vector();
+        data = out._storage.payload.data();
+    }
+    detail::ViewReader reader(data, len);
+    if (!detail::read_view(reader, out._storage, out._value)) {
+        __ZENOH_RESULT_CHECK(Z_EDESERIALIZE, err, "Deserialization failure");
+    } else if (!reader.is_done()) {
+        __ZENOH_RESULT_CHECK(Z_EDESERIALIZE, err, "Payload contains more bytes than required for deserialization");
+    } else if (err != nullptr) {
+        *err = Z_OK;
+    }
+    return out;
+}
+
 }  // namespace ext
 }  // namespace zenoh
@@ -89,7 +89,7 @@ class SessionExt {
     /// thrown in case of error.
     /// @return declared ``PublicationCache`` instance.
     [[deprecated("Use declare_advanced_publisher instead.")]] [[nodiscard]] PublicationCache declare_publication_cache(
-        const KeyExpr& key_expr, PublicationCacheOptions&& options = PublicationCacheOptions::create_default(),
+        const KeyExprView& key_expr, PublicationCacheOptions&& options = PublicationCacheOptions::create_default(),
         zenoh::ZResult* err = nullptr) const {
         ::ze_publication_cache_options_t opts = zenoh::interop::detail::Converter::to_c_opts(options);
 
@@ -110,7 +110,7 @@ class SessionExt {
     /// thrown in case of error.
     [[deprecated]]
     void declare_background_publication_cache(
-        const KeyExpr& key_expr, PublicationCacheOptions&& options = PublicationCacheOptions::create_default(),
+        const KeyExprView& key_expr, PublicationCacheOptions&& options = PublicationCacheOptions::create_default(),
         zenoh::ZResult* err = nullptr) const {
         ::ze_publication_cache_options_t opts = zenoh::interop::detail::Converter::to_c_opts(options);
         zenoh::ZResult res = ::ze_declare_background_publication_cache(
@@ -168,7 +168,7 @@ class SessionExt {
     /// @return declared ``QueryingSubscriber`` instance.
     template <class C, class D>
     [[nodiscard]] [[deprecated("Use declare_advanced_subscriber instead.")]] QueryingSubscriber<void>
-    declare_querying_subscriber(const KeyExpr& key_expr, C&& on_sample, D&& on_drop,
+    declare_querying_subscriber(const KeyExprView& key_expr, C&& on_sample, D&& on_drop,
                                 QueryingSubscriberOptions&& options = QueryingSubscriberOptions::create_default(),
                                 zenoh::ZResult* err = nullptr) const {
         static_assert(
@@ -182,8 +182,8 @@ class SessionExt {
         using Dval = std::remove_reference_t<D>;
         using ClosureType = typename zenoh::detail::closures::Closure<Cval, Dval, void, zenoh::Sample&>;
         auto closure = ClosureType::into_context(std::forward<C>(on_sample), std::forward<D>(on_drop));
-        ::z_closure(&c_closure, zenoh::detail::closures::_zenoh_on_sample_call, zenoh::detail::closures::_zenoh_on_drop,
-                    closure);
+        ::z_closure(&c_closure, zenoh::detail::closures::_zenoh_on_sample_call_static<ClosureType>,
+                    zenoh::detail::closures::_zenoh_on_drop_static<ClosureType>, closure);
         QueryingSubscriber<void> qs = zenoh::interop::detail::null<QueryingSubscriber<void>>();
         zenoh::ZResult res = ::ze_declare_querying_subscriber(
             zenoh::interop::as_loaned_c_ptr(this->_session), zenoh::interop::as_owned_c_ptr(qs),
@@ -204,7 +204,7 @@ class SessionExt {
     template <class C, class D>
     [[deprecated("Use declare_background_advanced_subscriber instead.")]]
     void declare_background_querying_subscriber(
-        const KeyExpr& key_expr, C&& on_sample, D&& on_drop,
+        const KeyExprView& key_expr, C&& on_sample, D&& on_drop,
         QueryingSubscriberOptions&& options = QueryingSubscriberOptions::create_default(),
         zenoh::ZResult* err = nullptr) const {
         static_assert(
@@ -217,8 +217,8 @@ class SessionExt {
         using Dval = std::remove_reference_t<D>;
         using ClosureType = typename zenoh::detail::closures::Closure<Cval, Dval, void, const zenoh::Sample&>;
         auto closure = ClosureType::into_context(std::forward<C>(on_sample), std::forward<D>(on_drop));
-        ::z_closure(&c_closure, zenoh::detail::closures::_zenoh_on_sample_call, zenoh::detail::closures::_zenoh_on_drop,
-                    closure);
+        ::z_closure(&c_closure, zenoh::detail::closures::_zenoh_on_sample_call_static<ClosureType>,
+                    zenoh::detail::closures::_zenoh_on_drop_static<ClosureType>, closure);
         ::ze_querying_subscriber_options_t opts = zenoh::interop::detail::Converter::to_c_opts(options);
         zenoh::ZResult res = ::ze_declare_background_querying_subscriber(
             zenoh::interop::as_loaned_c_ptr(this->_session), zenoh::interop::as_loaned_c_ptr(key_expr),
@@ -239,7 +239,7 @@ class SessionExt {
     template <class Channel>
     [[deprecated("Use declare_advanced_subscriber instead.")]] [[nodiscard]] QueryingSubscriber<
         typename Channel::template HandlerType<zenoh::Sample>>
-    declare_querying_subscriber(const KeyExpr& key_expr, Channel channel,
+    declare_querying_subscriber(const KeyExprView& key_expr, Channel channel,
                                 QueryingSubscriberOptions&& options = QueryingSubscriberOptions::create_default(),
                                 zenoh::ZResult* err = nullptr) const {
         auto cb_handler_pair = channel.template into_cb_handler_pair<Sample>();
@@ -249,7 +249,7 @@ class SessionExt {
             zenoh::interop::as_loaned_c_ptr(this->_session), zenoh::interop::as_owned_c_ptr(qs),
             zenoh::interop::as_loaned_c_ptr(key_expr), ::z_move(cb_handler_pair.first), &opts);
         if (res != Z_OK && err == nullptr) {
-            ::z_drop(interop::as_moved_c_ptr(cb_handler_pair.second));
+            interop::detail::drop_handler(cb_handler_pair.second);
         }
         __ZENOH_RESULT_CHECK(res, err, "Failed to declare Querying Subscriber");
         return QueryingSubscriber<typename Channel::template HandlerType<zenoh::Sample>>(
@@ -386,7 +386,7 @@ class SessionExt {
     /// thrown in case of error.
     /// @return an ``AdvancedPublisher`` object.
     AdvancedPublisher declare_advanced_publisher(
-        const KeyExpr& key_expr, AdvancedPublisherOptions&& options = AdvancedPublisherOptions::create_default(),
+        const KeyExprView& key_expr, AdvancedPublisherOptions&& options = AdvancedPublisherOptions::create_default(),
         zenoh::ZResult* err = nullptr) const {
         ::ze_advanced_publisher_options_t opts = zenoh::interop::detail::Converter::to_c_opts(options);
         AdvancedPublisher p = zenoh::interop::detail::null<AdvancedPublisher>();
@@ -528,7 +528,7 @@ class SessionExt {
     /// @return a ``Subscriber`` object.
     template <class C, class D>
     [[nodiscard]] AdvancedSubscriber<void> declare_advanced_subscriber(
-        const KeyExpr& key_expr, C&& on_sample, D&& on_drop,
+        const KeyExprView& key_expr, C&& on_sample, D&& on_drop,
         AdvancedSubscriberOptions&& options = AdvancedSubscriberOptions::create_default(),
         zenoh::ZResult* err = nullptr) const {
         static_assert(
@@ -541,8 +541,8 @@ class SessionExt {
         using Dval = std::remove_reference_t<D>;
         using ClosureType = typename zenoh::detail::closures::Closure<Cval, Dval, void, const Sample&>;
         auto closure = ClosureType::into_context(std::forward<C>(on_sample), std::forward<D>(on_drop));
-        ::z_closure(&c_closure, zenoh::detail::closures::_zenoh_on_sample_call, zenoh::detail::closures::_zenoh_on_drop,
-                    closure);
+        ::z_closure(&c_closure, zenoh::detail::closures::_zenoh_on_sample_call_static<ClosureType>,
+                    zenoh::detail::closures::_zenoh_on_drop_static<ClosureType>, closure);
         ::ze_advanced_subscriber_options_t opts = zenoh::interop::detail::Converter::to_c_opts(options);
         AdvancedSubscriber<void> s = zenoh::interop::detail::null<AdvancedSubscriber<void>>();
         zenoh::ZResult res = ::ze_declare_advanced_subscriber(
@@ -564,7 +564,7 @@ class SessionExt {
     /// thrown in case of error.
     template <class C, class D>
     void declare_background_advanced_subscriber(
-        const KeyExpr& key_expr, C&& on_sample, D&& on_drop,
+        const KeyExprView& key_expr, C&& on_sample, D&& on_drop,
         AdvancedSubscriberOptions&& options = AdvancedSubscriberOptions::create_default(),
         zenoh::ZResult* err = nullptr) const {
         static_assert(
@@ -577,8 +577,8 @@ class SessionExt {
         using Dval = std::remove_reference_t<D>;
         using ClosureType = typename zenoh::detail::closures::Closure<Cval, Dval, void, const zenoh::Sample&>;
         auto closure = ClosureType::into_context(std::forward<C>(on_sample), std::forward<D>(on_drop));
-        ::z_closure(&c_closure, zenoh::detail::closures::_zenoh_on_sample_call, zenoh::detail::closures::_zenoh_on_drop,
-                    closure);
+        ::z_closure(&c_closure, zenoh::detail::closures::_zenoh_on_sample_call_static<ClosureType>,
+                    zenoh::detail::closures::_zenoh_on_drop_static<ClosureType>, closure);
         ::ze_advanced_subscriber_options_t opts = zenoh::interop::detail::Converter::to_c_opts(options);
         ZResult res = ::ze_declare_background_advanced_subscriber(zenoh::interop::as_loaned_c_ptr(this->_session),
                                                                   zenoh::interop::as_loaned_c_ptr(key_expr),
@@ -598,7 +598,7 @@ class SessionExt {
     /// @return a ``Subscriber`` object.
     template <class Channel>
     [[nodiscard]] AdvancedSubscriber<typename Channel::template HandlerType<Sample>> declare_advanced_subscriber(
-        const KeyExpr& key_expr, Channel channel,
+        const KeyExprView& key_expr, Channel channel,
         AdvancedSubscriberOptions&& options = AdvancedSubscriberOptions::create_default(),
         zenoh::ZResult* err = nullptr) const {
         auto cb_handler_pair = channel.template into_cb_handler_pair<Sample>();
@@ -608,7 +608,7 @@ class SessionExt {
             zenoh::interop::as_loaned_c_ptr(this->_session), zenoh::interop::as_owned_c_ptr(s),
             zenoh::interop::as_loaned_c_ptr(key_expr), ::z_move(cb_handler_pair.first), &opts);
         if (res != Z_OK && err == nullptr) {
-            ::z_drop(interop::as_moved_c_ptr(cb_handler_pair.second));
+            interop::detail::drop_handler(cb_handler_pair.second);
         }
         __ZENOH_RESULT_CHECK(res, err, "Failed to declare Advanced Subscriber");
         return AdvancedSubscriber<typename Channel::template HandlerType<Sample>>(std::move(s),
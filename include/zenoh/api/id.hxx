@@ -14,6 +14,8 @@
 #pragma once
 
 #include <array>
+#include <cstring>
+#include <functional>
 #include <iomanip>
 #include <iostream>
 #include <string_view>
@@ -62,4 +64,18 @@ inline std::ostream& operator<<(std::ostream& os, const Id& id) {
     ::z_drop(::z_move(s));
     return os;
 }
-}  // namespace zenoh
\ No newline at end of file
+}  // namespace zenoh
+
+namespace std {
+/// @brief Hash of a Zenoh ID.
+template <>
+struct hash<zenoh::Id> {
+    size_t operator()(const zenoh::Id& id) const {
+        // Zenoh IDs are random, so folding their halves is enough to get a well-distributed hash
+        uint64_t lo, hi;
+        std::memcpy(&lo, id.bytes().data(), sizeof(lo));
+        std::memcpy(&hi, id.bytes().data() + sizeof(lo), sizeof(hi));
+        return std::hash<uint64_t>()(lo ^ (hi * 0x9e3779b97f4a7c15ull));
+    }
+};
+}  // namespace std
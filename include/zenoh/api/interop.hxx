@@ -205,6 +205,19 @@ T null() {
     return Converter::null_owned<T>();
 }
 
+template <class OwnedType>
+std::true_type is_owned_test(const Owned<OwnedType>*);
+std::false_type is_owned_test(...);
+
+/// @brief Release the resources held by a channel handler. Handlers which do not wrap a zenoh-c object release their
+/// resources on destruction, so nothing is done for them.
+template <class Handler>
+void drop_handler(Handler& h) {
+    if constexpr (decltype(is_owned_test(&h))::value) {
+        ::z_drop(as_moved_c_ptr(h));
+    }
+}
+
 }  // namespace detail
 
 /// @brief Copy copyable zenoh-c struct into corresponding zenoh-cpp object.
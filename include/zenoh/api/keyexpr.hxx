@@ -12,6 +12,8 @@
 //   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
 
 #pragma once
+#include <functional>
+#include <optional>
 #include <string_view>
 
 #include "../zenohc.hxx"
@@ -20,6 +22,100 @@
 
 namespace zenoh {
 
+namespace detail {
+/// Check if a chunk of key expression is canonical. Return error description or `nullptr`.
+constexpr const char* keyexpr_chunk_canon_error(std::string_view c) {
+    if (c.empty()) return "empty chunk";
+    if (c == "*" || c == "**") return nullptr;
+    const bool verbatim = c[0] == '@';
+    for (size_t i = 0; i < c.size(); i++) {
+        switch (c[i]) {
+            case '#':
+            case '?':
+                return "forbidden character";
+            case '*':
+                return "'*' must be the only character of a chunk, or be preceded by '$'";
+            case '$':
+                if (i + 1 == c.size() || c[i + 1] != '*') return "'$' must be followed by '*'";
+                if (verbatim) return "verbatim chunk can not contain wildcards";
+                if (c.size() == 2) return "'$*' chunk must be replaced by '*'";
+                if (i + 3 < c.size() && c[i + 2] == '$' && c[i + 3] == '*') return "'$*$*' must be replaced by '$*'";
+                i++;
+                break;
+            default:
+                break;
+        }
+    }
+    return nullptr;
+}
+
+/// Check if a key expression is canonical. Return error description or `nullptr`.
+constexpr const char* keyexpr_canon_error(std::string_view key_expr) {
+    if (key_expr.empty()) return "empty key expression";
+    std::string_view prev;
+    size_t start = 0;
+    while (true) {
+        size_t end = key_expr.find('/', start);
+        std::string_view chunk = key_expr.substr(start, end == std::string_view::npos ? end : end - start);
+        if (const char* e = keyexpr_chunk_canon_error(chunk); e != nullptr) return e;
+        if (prev == "**" && chunk == "**") return "'**/**' must be replaced by '**'";
+        if (prev == "**" && chunk == "*") return "'**/*' must be replaced by '*/**'";
+        if (end == std::string_view::npos) return nullptr;
+        prev = chunk;
+        start = end + 1;
+    }
+}
+}  // namespace detail
+
+/// @brief A key expression string validated to be in canonical form at compile time.
+///
+/// Instances are intended to be created with the ``_ke`` literal, or declared ``constexpr``, in which case a
+/// non-canonical key expression is reported as a compilation error. Converting an instance to ``KeyExprView`` neither
+/// parses nor allocates.
+class KeyExprLiteral {
+    std::string_view _key_expr;
+
+   public:
+    /// @name Constructors
+
+    /// @brief Create a new instance from a string.
+    /// @param key_expr canonical key expression, the referenced string must outlive the instance. If it is not
+    /// canonical, constant evaluation fails, while at runtime a ZException is thrown.
+    constexpr explicit KeyExprLiteral(std::string_view key_expr) : _key_expr(key_expr) {
+        if (detail::keyexpr_canon_error(key_expr) != nullptr) {
+            // the key expression is not canonical
+            throw ZException(std::string("Non-canonical key expression: ").append(key_expr), -1);
+        }
+    }
+
+    /// @name Methods
+
+    /// @brief Get underlying key expression string.
+    constexpr std::string_view as_string_view() const { return _key_expr; }
+};
+
+inline namespace literals {
+/// @brief Create a key expression literal.
+///
+/// Since C++20 the literal is always validated at compile time. With earlier standards it is only validated at
+/// compile time in a constant context, e.g. when initializing a ``constexpr`` variable, and otherwise at each
+/// evaluation, throwing a ZException if it is not canonical:
+///
+/// @code{.cpp}
+/// constexpr auto pose = "robot/1/pose"_ke;
+/// session.put(pose, Bytes("data"));
+/// @endcode
+#if defined(__cpp_consteval)
+consteval KeyExprLiteral operator""_ke(const char* key_expr, size_t len) {
+    return KeyExprLiteral(std::string_view(key_expr, len));
+}
+#else
+constexpr KeyExprLiteral operator""_ke(const char* key_expr, size_t len) {
+    return KeyExprLiteral(std::string_view(key_expr, len));
+}
+#endif
+}  // namespace literals
+
 /// @brief A Zenoh <a href="https://zenoh.io/docs/manual/abstractions/#key-expression"> key expression </a>.
 ///
 /// Key expression can be registered in the `zenoh::Session` object with `zenoh::Session::declare_keyexpr` method.
@@ -208,4 +304,162 @@ class KeyExpr : public Owned<::z_owned_keyexpr_t> {
     KeyExpr& operator=(KeyExpr&& other) = default;
 };
 
-}  // namespace zenoh
\ No newline at end of file
+/// @brief A ``KeyExpr`` together with its hash, computed once at construction.
+///
+/// It is intended for key expressions used as keys of hash maps, e.g. the ones returned by
+/// ``Session::declare_keyexpr``, so that lookups do not rehash the key expression string. The key expression itself
+/// is accessible with ``HashedKeyExpr::get_keyexpr``.
+class HashedKeyExpr {
+    KeyExpr _key_expr;
+    size_t _hash;
+
+   public:
+    /// @name Constructors
+
+    /// @brief Create a new instance from a key expression.
+    explicit HashedKeyExpr(KeyExpr&& key_expr)
+        : _key_expr(std::move(key_expr)), _hash(std::hash<std::string_view>()(_key_expr.as_string_view())) {}
+
+    /// @brief Create a new instance from a key expression.
+    explicit HashedKeyExpr(const KeyExpr& key_expr) : HashedKeyExpr(KeyExpr(key_expr)) {}
+
+    /// @name Methods
+
+    /// @brief Get the key expression.
+    const KeyExpr& get_keyexpr() const { return this->_key_expr; }
+
+    /// @brief Get the hash of the key expression, equal to ``std::hash<KeyExpr>`` of it.
+    size_t hash() const { return this->_hash; }
+
+    /// @name Operators
+
+    /// @brief Get the key expression.
+    operator const KeyExpr&() const { return this->_key_expr; }
+
+    /// @brief Equality relation.
+    /// @param other a key expression to compare with.
+    /// @return ``true`` if both key expressions are equal, ``false`` otherwise.
+    bool operator==(const HashedKeyExpr& other) const {
+        return this->_hash == other._hash && this->_key_expr == other._key_expr;
+    }
+
+    /// @brief Inequality relation.
+    /// @param other a key expression to compare with.
+    /// @return ``false`` if both key expressions are equal, ``true`` otherwise.
+    bool operator!=(const HashedKeyExpr& other) const { return !(*this == other); }
+};
+
+/// @brief A non-owning key expression, referencing a string or a ``KeyExpr`` owned elsewhere.
+///
+/// All ``Session`` methods taking a key expression accept a ``KeyExprView``, which is implicitly constructed from
+/// ``KeyExpr``, ``HashedKeyExpr``, ``KeyExprLiteral`` or strings. Unlike a temporary ``KeyExpr``, it does not copy the
+/// key expression string: a canonical string is only validated, and a ``KeyExprLiteral`` is not even validated. A
+/// non-canonical string is autocanonized into an owned copy, as ``KeyExpr`` constructor would do.
+///
+/// The referenced string or ``KeyExpr`` must outlive the instance, it is thus recommended to only use ``KeyExprView``
+/// as a function argument.
+class KeyExprView {
+    ::z_view_keyexpr_t _view = {};
+    const KeyExpr* _key_expr = nullptr;
+    std::optional<KeyExpr> _canonized;
+
+    struct Unchecked {};
+    KeyExprView(Unchecked, std::string_view key_expr) {
+        ::z_view_keyexpr_from_substr_unchecked(&this->_view, key_expr.data(), key_expr.size());
+    }
+
+    const ::z_loaned_keyexpr_t* loan() const {
+        if (this->_key_expr != nullptr) return interop::as_loaned_c_ptr(*this->_key_expr);
+        if (this->_canonized.has_value()) return interop::as_loaned_c_ptr(*this->_canonized);
+        return ::z_loan(this->_view);
+    }
+
+   public:
+    /// @name Constructors
+
+    /// @brief Create a view of a key expression validated at compile time.
+    KeyExprView(const KeyExprLiteral& key_expr) : KeyExprView(Unchecked{}, key_expr.as_string_view()) {}
+
+    /// @brief Create a view of a key expression.
+    KeyExprView(const KeyExpr& key_expr) : _key_expr(&key_expr) {}
+
+    /// @brief Create a view of a hashed key expression.
+    KeyExprView(const HashedKeyExpr& key_expr) : _key_expr(&key_expr.get_keyexpr()) {}
+
+    /// @brief Create a view of a key expression string.
+    ///
+    /// @param key_expr string representing key expression, if it is not canonical it is copied and autocanonized.
+    /// @param err if not null, the result code will be written to this location, otherwise ZException exception will be
+    /// thrown in case of error.
+    KeyExprView(std::string_view key_expr, ZResult* err = nullptr) {
+#if defined(ZENOHCXX_ZENOHPICO)
+        // zenoh-pico does not validate the string when creating a view
+        bool canon = KeyExpr::is_canon(key_expr) &&
+                     ::z_view_keyexpr_from_substr(&this->_view, key_expr.data(), key_expr.size()) == Z_OK;
+#else
+        bool canon = ::z_view_keyexpr_from_substr(&this->_view, key_expr.data(), key_expr.size()) == Z_OK;
+#endif
+        if (!canon) {
+            this->_canonized.emplace(key_expr, true, err);
+        } else if (err != nullptr) {
+            *err = Z_OK;
+        }
+    }
+
+    /// @brief Create a view of a key expression string.
+    ///
+    /// @param key_expr string representing key expression, if it is not canonical it is copied and autocanonized.
+    /// @param err if not null, the result code will be written to this location, otherwise ZException exception will be
+    /// thrown in case of error.
+    KeyExprView(const std::string& key_expr, ZResult* err = nullptr)
+        : KeyExprView(static_cast<std::string_view>(key_expr), err) {}
+
+    /// @brief Create a view of a null-terminated key expression string.
+    ///
+    /// @param key_expr null-terminated string representing key expression, if it is not canonical it is copied and
+    /// autocanonized.
+    /// @param err if not null, the result code will be written to this location, otherwise ZException exception will be
+    /// thrown in case of error.
+    KeyExprView(const char* key_expr, ZResult* err = nullptr) : KeyExprView(std::string_view(key_expr), err) {}
+
+    /// @brief Create a view of a key expression string, without checking that it is canonical.
+    /// @param key_expr canonical key expression, passing a non-canonical one results in undefined behavior.
+    static KeyExprView from_canonical_unchecked(std::string_view key_expr) {
+        return KeyExprView(Unchecked{}, key_expr);
+    }
+
+    /// @name Methods
+
+    /// @brief Get underlying key expression string.
+    std::string_view as_string_view() const { return static_cast<const KeyExpr&>(*this).as_string_view(); }
+
+    /// @name Operators
+
+    /// @brief Get the key expression referenced by the view.
+    operator const KeyExpr&() const { return interop::as_owned_cpp_ref<KeyExpr>(this->loan()); }
+};
+
+namespace interop {
+/// @brief Get loaned zenoh-c representation of a key expression view.
+inline const ::z_loaned_keyexpr_t* as_loaned_c_ptr(const KeyExprView& key_expr) {
+    return as_loaned_c_ptr(static_cast<const KeyExpr&>(key_expr));
+}
+}  // namespace interop
+
+}  // namespace zenoh
+
+namespace std {
+/// @brief Hash of a key expression, computed from its canonical string representation.
+template <>
+struct hash<zenoh::KeyExpr> {
+    size_t operator()(const zenoh::KeyExpr& key_expr) const {
+        return std::hash<std::string_view>()(key_expr.as_string_view());
+    }
+};
+
+/// @brief Hash of a key expression, computed once at its construction.
+template <>
+struct hash<zenoh::HashedKeyExpr> {
+    size_t operator()(const zenoh::HashedKeyExpr& key_expr) const { return key_expr.hash(); }
+};
+}  // namespace std
@@ -0,0 +1,229 @@
+//
+// Copyright (c) 2024 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+#include "base.hxx"
+#include "bytes.hxx"
+#include "keyexpr.hxx"
+#include "session.hxx"
+
+namespace zenoh {
+
+/// @brief Statistics collected by a ``KeyExprCache``.
+struct KeyExprCacheStats {
+    /// @brief Number of resolutions served by an already declared key expression.
+    uint64_t hits = 0;
+    /// @brief Number of resolutions of key expressions which were not declared yet.
+    uint64_t misses = 0;
+    /// @brief Total number of key expressions declared by the cache.
+    uint64_t declarations = 0;
+    /// @brief Total number of declared key expressions undeclared to make room for hotter ones.
+    uint64_t evictions = 0;
+    /// @brief Number of key expressions currently declared by the cache.
+    size_t declared = 0;
+    /// @brief Number of key expressions whose usage is currently tracked by the cache (including declared ones).
+    size_t tracked = 0;
+};
+
+/// @brief A cache automatically declaring frequently used key expressions on a ``Session``.
+///
+/// Each key expression passed to ``KeyExprCache::resolve`` (or ``KeyExprCache::put``) has its number of uses counted.
+/// Once it has been used ``declare_threshold`` times it is declared with ``Session::declare_keyexpr``, so that
+/// subsequent operations on it send the compact numeric id of the declaration instead of the full key string. Both
+/// the number of declared key expressions and the number of tracked use counters are bounded: the least recently
+/// used declaration is undeclared when ``capacity`` is reached, and the counter of the least recently used key
+/// expression which is not declared is dropped when ``max_tracked`` is reached. Both operations take constant time.
+///
+/// The cache is not thread-safe, its lifetime is bound to that of the session.
+///
+/// @code{.cpp}
+/// KeyExprCache cache(session);
+/// for (size_t i = 0; i < 1000; i++) {
+///     cache.put("robot/1/pose", Bytes("data"));
+/// }
+/// @endcode
+class KeyExprCache {
+    struct Entry;
+    using Node = std::pair<const std::string, Entry>;
+
+    struct Entry {
+        /// Number of uses since the entry was last reset.
+        size_t uses = 0;
+        std::optional<KeyExpr> declared;
+        /// Position in `_declared` if the key expression is declared, in `_undeclared` otherwise.
+        std::list<Node*>::iterator position;
+    };
+
+    const Session& _session;
+    size_t _capacity;
+    size_t _declare_threshold;
+    size_t _max_tracked;
+    std::unordered_map<std::string, Entry> _entries;
+    /// Declared entries, most recently used first.
+    std::list<Node*> _declared;
+    /// Entries which are not declared, most recently used first.
+    std::list<Node*> _undeclared;
+    /// Buffer for looking up entries without allocating a new string on each resolution.
+    std::string _lookup;
+    KeyExprCacheStats _stats;
+
+    /// Drop counters of the least recently used key expressions which are not declared, until there is room for a
+    /// new entry.
+    void age() {
+        while (this->_entries.size() >= this->_max_tracked && !this->_undeclared.empty()) {
+            Node* n = this->_undeclared.back();
+            this->_undeclared.pop_back();
+            this->_entries.erase(n->first);
+        }
+    }
+
+    /// Undeclare the least recently used declared key expression.
+    void evict() {
+        if (this->_declared.empty()) return;
+        this->undeclare(this->_declared.back()->second);
+        this->_stats.evictions++;
+    }
+
+    void undeclare(Entry& e) {
+        ZResult err;
+        this->_session.undeclare_keyexpr(std::move(*e.declared), &err);
+        e.declared.reset();
+        e.uses = 0;
+        this->_undeclared.splice(this->_undeclared.begin(), this->_declared, e.position);
+        this->_stats.declared--;
+    }
+
+    void declare(Entry& e, const KeyExprView& key_expr) {
+        if (this->_stats.declared >= this->_capacity) this->evict();
+        ZResult err;
+        KeyExpr declared = this->_session.declare_keyexpr(key_expr, &err);
+        if (err != Z_OK) {
+            // retry once the key expression is used `declare_threshold` more times
+            e.uses = 0;
+            return;
+        }
+        e.declared.emplace(std::move(declared));
+        this->_declared.splice(this->_declared.begin(), this->_undeclared, e.position);
+        this->_stats.declarations++;
+        this->_stats.declared++;
+    }
+
+   public:
+    /// @brief Options to be passed when constructing a ``KeyExprCache``.
+    struct KeyExprCacheOptions {
+        /// @name Fields
+
+        /// @brief Maximum number of key expressions declared by the cache, if 0 no key expression is declared.
+        size_t capacity = 64;
+        /// @brief Number of uses of a key expression after which it is declared.
+        size_t declare_threshold = 16;
+        /// @brief Maximum number of key expressions whose uses are counted, it is raised to ``capacity + 1`` if lower.
+        size_t max_tracked = 4096;
+
+        /// @name Methods
+
+        /// @brief Create default option settings.
+        static KeyExprCacheOptions create_default() { return {}; }
+    };
+
+    /// @name Constructors
+
+    /// @brief Create a cache of key expression declarations on ``session``.
+    /// @param session session on which key expressions are declared, it must outlive the cache.
+    /// @param options options to pass to cache creation.
+    KeyExprCache(const Session& session, KeyExprCacheOptions&& options = KeyExprCacheOptions::create_default())
+        : _session(session),
+          _capacity(options.capacity),
+          _declare_threshold(std::max<size_t>(options.declare_threshold, 1)),
+          _max_tracked(std::max(options.max_tracked, options.capacity + 1)) {}
+
+    KeyExprCache(const KeyExprCache&) = delete;
+    KeyExprCache& operator=(const KeyExprCache&) = delete;
+
+    /// @brief Destructor. Undeclares all key expressions declared by the cache.
+    ~KeyExprCache() { this->clear(); }
+
+    /// @name Methods
+
+    /// @brief Count a use of a key expression, and get the key expression to pass to session operations.
+    ///
+    /// Failure to declare a key expression is not an error: the full key expression is used instead.
+    /// @param key_expr key expression.
+    /// @return view of the declared key expression if ``key_expr`` is hot, or of ``key_expr`` otherwise. It is valid
+    /// until the next call to a non-const method of the cache or the destruction of ``key_expr``, whichever comes
+    /// first.
+    KeyExprView resolve(const KeyExprView& key_expr) {
+        std::string_view s = key_expr.as_string_view();
+        this->_lookup.assign(s.data(), s.size());
+        auto it = this->_entries.find(this->_lookup);
+        if (it != this->_entries.end() && it->second.declared.has_value()) {
+            this->_declared.splice(this->_declared.begin(), this->_declared, it->second.position);
+            this->_stats.hits++;
+            return KeyExprView(*it->second.declared);
+        }
+        this->_stats.misses++;
+        if (it == this->_entries.end()) {
+            this->age();
+            it = this->_entries.emplace(this->_lookup, Entry{}).first;
+            it->second.position = this->_undeclared.insert(this->_undeclared.begin(), &*it);
+        } else {
+            this->_undeclared.splice(this->_undeclared.begin(), this->_undeclared, it->second.position);
+        }
+        Entry& e = it->second;
+        if (++e.uses >= this->_declare_threshold && this->_capacity > 0) {
+            this->declare(e, key_expr);
+            if (e.declared.has_value()) return KeyExprView(*e.declared);
+        }
+        return KeyExprView::from_canonical_unchecked(s);
+    }
+
+#if defined(ZENOHCXX_ZENOHC) || Z_FEATURE_PUBLICATION == 1
+    /// @brief Publish data to the matching subscribers in the system, using the declared key expression if
+    /// ``key_expr`` is hot. Equivalent to ``Session::put(cache.resolve(key_expr), ...)``.
+    /// @param key_expr the key expression to put the data.
+    /// @param payload the data to publish.
+    /// @param options options to pass to put operation.
+    /// @param err if not null, the result code will be written to this location, otherwise ZException exception will be
+    /// thrown in case of error.
+    void put(const KeyExprView& key_expr, Bytes&& payload,
+             Session::PutOptions&& options = Session::PutOptions::create_default(), ZResult* err = nullptr) {
+        this->_session.put(this->resolve(key_expr), std::move(payload), std::move(options), err);
+    }
+#endif
+
+    /// @brief Undeclare all key expressions declared by the cache and reset all use counters.
+    void clear() {
+        while (!this->_declared.empty()) this->undeclare(this->_declared.front()->second);
+        this->_undeclared.clear();
+        this->_entries.clear();
+    }
+
+    /// @brief Get the cache statistics.
+    KeyExprCacheStats get_stats() const {
+        KeyExprCacheStats s = this->_stats;
+        s.tracked = this->_entries.size();
+        return s;
+    }
+};
+
+}  // namespace zenoh
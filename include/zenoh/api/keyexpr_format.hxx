@@ -0,0 +1,288 @@
+//
+// Copyright (c) 2024 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+
+#pragma once
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../detail/keyexpr_chunks.hxx"
+#include "base.hxx"
+#include "keyexpr.hxx"
+
+namespace zenoh {
+
+/// @brief A key expression format, i.e. a key expression with named placeholders, like
+/// ``fleet/${robot:*}/sensor/${id:*}/imu``.
+///
+/// Each placeholder has the form ``${name:pattern}``, where ``pattern`` is a key expression which must include the
+/// values substituted for the placeholder. A placeholder must span whole chunks, i.e. be delimited by ``/`` or by the
+/// format boundaries. The format is parsed and validated once at construction, after which ``KeyExprFormat::Formatter``
+/// builds key expressions by only validating the substituted values, and ``KeyExprFormat::parse`` extracts the values
+/// of placeholders from key expressions without allocating (except when a pattern chunk containing ``$*`` is matched
+/// against a chunk longer than 63 characters).
+///
+/// The format must outlive the formatters created from it.
+class KeyExprFormat {
+    struct Placeholder {
+        std::string_view name;
+        std::string_view pattern;
+        /// Number of chunks of matching values, if fixed (i.e. if pattern does not contain ``**``).
+        std::optional<size_t> chunks;
+    };
+
+    std::string _format;
+    /// Constant parts of the format, `_literals[i]` precedes `_placeholders[i]`, and the last one follows the last
+    /// placeholder. Inner literals start and end with `/`.
+    std::vector<std::string_view> _literals;
+    std::vector<Placeholder> _placeholders;
+
+    static size_t count_chunks(std::string_view s) {
+        size_t n = 1;
+        for (char c : s) n += (c == '/');
+        return n;
+    }
+
+    static bool is_valid_literal(std::string_view l, bool first, bool last) {
+        if (first && last) return detail::keyexpr_canon_error(l) == nullptr;
+        // placeholder at the start or at the end of the format
+        if (l.empty()) return first || last;
+        // literal separating two placeholders
+        if (!first && !last && l == "/") return true;
+        if (!first) {
+            if (l.front() != '/') return false;
+            l.remove_prefix(1);
+        }
+        if (!last) {
+            if (l.empty() || l.back() != '/') return false;
+            l.remove_suffix(1);
+        }
+        return detail::keyexpr_canon_error(l) == nullptr;
+    }
+
+    void parse_format(ZResult* err) {
+        std::string_view f = this->_format;
+        size_t pos = 0;
+        while (true) {
+            size_t start = f.find("${", pos);
+            if (start == std::string_view::npos) break;
+            size_t end = f.find('}', start);
+            size_t colon = f.find(':', start);
+            if (end == std::string_view::npos || colon == std::string_view::npos || colon > end) {
+                __ZENOH_RESULT_CHECK(-1, err, std::string("Invalid placeholder in key expression format: ").append(f));
+                return;
+            }
+            Placeholder p;
+            p.name = f.substr(start + 2, colon - start - 2);
+            p.pattern = f.substr(colon + 1, end - colon - 1);
+            if (p.name.empty() || detail::keyexpr_canon_error(p.pattern) != nullptr) {
+                __ZENOH_RESULT_CHECK(-1, err, std::string("Invalid placeholder in key expression format: ").append(f));
+                return;
+            }
+            if (p.pattern.find(detail::keyexpr_chunks::DOUBLE_WILD) == std::string_view::npos) {
+                p.chunks = count_chunks(p.pattern);
+            }
+            this->_literals.push_back(f.substr(pos, start - pos));
+            this->_placeholders.push_back(p);
+            pos = end + 1;
+        }
+        this->_literals.push_back(f.substr(pos));
+        for (size_t i = 0; i < this->_literals.size(); i++) {
+            if (!is_valid_literal(this->_literals[i], i == 0, i + 1 == this->_literals.size())) {
+                __ZENOH_RESULT_CHECK(-1, err, std::string("Invalid key expression format: ").append(f));
+                return;
+            }
+        }
+        __ZENOH_RESULT_CHECK(Z_OK, err, "");
+    }
+
+    /// Check if `value` can be substituted to placeholder `i`.
+    bool is_valid_value(size_t i, std::string_view value) const {
+        const Placeholder& p = this->_placeholders[i];
+        return detail::keyexpr_canon_error(value) == nullptr &&
+               detail::keyexpr_chunks::keyexpr_includes(p.pattern, value);
+    }
+
+    /// Match `key_expr` from offset `pos` against the format starting with literal `i`.
+    bool match(std::string_view key_expr, size_t pos, size_t i, std::vector<std::string_view>& values) const {
+        std::string_view l = this->_literals[i];
+        if (key_expr.compare(pos, l.size(), l) != 0) return false;
+        pos += l.size();
+        if (i == this->_placeholders.size()) return pos == key_expr.size();
+        const Placeholder& p = this->_placeholders[i];
+        // value ends at a chunk boundary: either at the end of the key expression or before a '/'
+        size_t end = pos;
+        size_t chunks = 0;
+        while (end < key_expr.size()) {
+            end = key_expr.find('/', end + 1);
+            if (end == std::string_view::npos) end = key_expr.size();
+            chunks++;
+            if (p.chunks.has_value() && chunks < *p.chunks) continue;
+            std::string_view value = key_expr.substr(pos, end - pos);
+            if (detail::keyexpr_chunks::keyexpr_includes(p.pattern, value) && match(key_expr, end, i + 1, values)) {
+                values[i] = value;
+                return true;
+            }
+            if (p.chunks.has_value()) break;
+        }
+        return false;
+    }
+
+   public:
+    /// @name Constructors
+
+    /// @brief Create a new key expression format.
+    /// @param format key expression with placeholders of the form ``${name:pattern}``.
+    /// @param err if not null, the result code will be written to this location, otherwise ZException exception will be
+    /// thrown in case of error.
+    KeyExprFormat(std::string_view format, ZResult* err = nullptr) : _format(format) { this->parse_format(err); }
+
+    KeyExprFormat(const KeyExprFormat& other) = delete;
+    KeyExprFormat(KeyExprFormat&& other) = delete;
+
+    /// @name Methods
+
+    /// @brief Get the format string.
+    std::string_view as_string_view() const { return this->_format; }
+
+    /// @brief Get the number of placeholders.
+    size_t size() const { return this->_placeholders.size(); }
+
+    /// @brief Get the index of a placeholder.
+    /// @param name name of the placeholder.
+    /// @return index of the placeholder, or an empty optional if the format has no placeholder named ``name``.
+    std::optional<size_t> index(std::string_view name) const {
+        for (size_t i = 0; i < this->_placeholders.size(); i++) {
+            if (this->_placeholders[i].name == name) return i;
+        }
+        return {};
+    }
+
+    /// @brief Extract the values of placeholders from a key expression.
+    ///
+    /// Constant parts of the format must match the key expression exactly, and each extracted value is included by
+    /// the pattern of its placeholder. Values of placeholders whose pattern contains ``**`` are found by trying each
+    /// possible number of chunks in turn, so that for a key expression of ``n`` chunks and ``k`` such placeholders,
+    /// parsing checks up to ``O(n^k)`` candidate values against their patterns. Formats whose patterns do not contain
+    /// ``**`` are parsed in a single pass.
+    /// @param key_expr key expression to parse, e.g. the one returned by ``Sample::get_keyexpr``.
+    /// @param values vector receiving the values of the placeholders, in order of appearance in the format. The values
+    /// reference ``key_expr`` string. The vector is only reallocated if its capacity is less than ``size()``.
+    /// @return ``true`` if ``key_expr`` matches the format, ``false`` otherwise.
+    bool parse(const KeyExprView& key_expr, std::vector<std::string_view>& values) const {
+        values.resize(this->_placeholders.size());
+        return this->match(key_expr.as_string_view(), 0, 0, values);
+    }
+
+    /// @brief A reusable builder of key expressions from a ``KeyExprFormat``.
+    ///
+    /// The formatter holds a buffer which is reused for each built key expression, so that building key expressions
+    /// does not allocate once the buffer is large enough.
+    class Formatter {
+        const KeyExprFormat* _format;
+        std::vector<std::string> _values;
+        std::vector<bool> _is_set;
+        std::string _buffer;
+        bool _has_wild_values = false;
+
+        friend class KeyExprFormat;
+        Formatter(const KeyExprFormat& format)
+            : _format(&format), _values(format.size()), _is_set(format.size(), false) {}
+
+        bool fill(ZResult* err) {
+            this->_buffer.clear();
+            for (size_t i = 0; i < this->_values.size(); i++) {
+                if (!this->_is_set[i]) {
+                    __ZENOH_RESULT_CHECK(-1, err,
+                                         std::string("Value is not set for placeholder: ")
+                                             .append(this->_format->_placeholders[i].name));
+                    return false;
+                }
+                this->_buffer.append(this->_format->_literals[i]);
+                this->_buffer.append(this->_values[i]);
+            }
+            this->_buffer.append(this->_format->_literals.back());
+            // wildcard values may form non-canonical sequences with adjacent chunks (e.g. `**/*`)
+            if (this->_has_wild_values && detail::keyexpr_canon_error(this->_buffer) != nullptr) {
+                __ZENOH_RESULT_CHECK(-1, err, std::string("Non-canonical key expression: ").append(this->_buffer));
+                return false;
+            }
+            __ZENOH_RESULT_CHECK(Z_OK, err, "");
+            return true;
+        }
+
+       public:
+        /// @name Methods
+
+        /// @brief Set the value of a placeholder.
+        /// @param index index of the placeholder.
+        /// @param value value to substitute to the placeholder, it must be a key expression included by the
+        /// placeholder pattern.
+        /// @param err if not null, the result code will be written to this location, otherwise ZException exception
+        /// will be thrown in case of error.
+        /// @return reference to the formatter.
+        Formatter& set(size_t index, std::string_view value, ZResult* err = nullptr) {
+            if (index >= this->_values.size() || !this->_format->is_valid_value(index, value)) {
+                __ZENOH_RESULT_CHECK(
+                    -1, err, std::string("Invalid value for key expression format placeholder: ").append(value));
+                return *this;
+            }
+            this->_values[index].assign(value.data(), value.size());
+            this->_is_set[index] = true;
+            this->_has_wild_values = false;
+            for (const auto& v : this->_values) {
+                this->_has_wild_values = this->_has_wild_values || v.find('*') != std::string::npos;
+            }
+            __ZENOH_RESULT_CHECK(Z_OK, err, "");
+            return *this;
+        }
+
+        /// @brief Set the value of a placeholder.
+        /// @param name name of the placeholder.
+        /// @param value value to substitute to the placeholder, it must be a key expression included by the
+        /// placeholder pattern.
+        /// @param err if not null, the result code will be written to this location, otherwise ZException exception
+        /// will be thrown in case of error.
+        /// @return reference to the formatter.
+        Formatter& set(std::string_view name, std::string_view value, ZResult* err = nullptr) {
+            return this->set(this->_format->index(name).value_or(this->_values.size()), value, err);
+        }
+
+        /// @brief Build a key expression referencing the internal buffer of the formatter, without validating
+        /// constant parts of the format again.
+        /// @param err if not null, the result code will be written to this location, otherwise ZException exception
+        /// will be thrown in case of error (i.e. if some placeholders are not set).
+        /// @return key expression view, valid until the next call to ``view`` or ``build``, or the destruction of the
+        /// formatter, or an empty optional in case of error.
+        std::optional<KeyExprView> view(ZResult* err = nullptr) {
+            if (!this->fill(err)) return {};
+            return KeyExprView::from_canonical_unchecked(this->_buffer);
+        }
+
+        /// @brief Build a key expression.
+        /// @param err if not null, the result code will be written to this location, otherwise ZException exception
+        /// will be thrown in case of error (i.e. if some placeholders are not set).
+        /// @return a new key expression.
+        KeyExpr build(ZResult* err = nullptr) {
+            if (!this->fill(err)) return interop::detail::null<KeyExpr>();
+            return KeyExpr(static_cast<const KeyExpr&>(KeyExprView::from_canonical_unchecked(this->_buffer)));
+        }
+    };
+
+    /// @brief Create a formatter with all placeholders unset.
+    Formatter formatter() const { return Formatter(*this); }
+};
+
+}  // namespace zenoh
@@ -0,0 +1,440 @@
+//
+// Copyright (c) 2024 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "../detail/keyexpr_chunks.hxx"
+#include "keyexpr.hxx"
+
+namespace zenoh {
+
+/// @brief Relation between key expressions stored in a ``KeyExprTree`` and the key expression of a query.
+enum class KeyExprTreeQuery {
+    /// @brief Stored key expressions intersecting with the queried one.
+    INTERSECTING,
+    /// @brief Stored key expressions included by the queried one.
+    INCLUDED_BY,
+    /// @brief Stored key expressions including the queried one.
+    INCLUDING
+};
+
+class KeyExprMatcher;
+
+/// @brief An in-process index of values associated to key expressions, supporting efficient wildcard matching.
+///
+/// Key expressions are stored as a tree of their chunks (i.e. ``a/b/c`` is stored as path ``a`` -> ``b`` -> ``c``),
+/// so that lookups of stored key expressions intersecting with, included by or including a given key expression walk
+/// only the matching branches of the tree, with time proportional to the size of the output rather than to the number
+/// of stored entries. Stored key expressions may themselves contain wildcards.
+///
+/// The tree is not thread-safe, and must not be modified from within the callbacks passed to the lookup methods.
+/// @tparam T type of values associated to key expressions.
+template <class T>
+class KeyExprTree {
+    struct Node {
+        std::string chunk;
+        Node* parent = nullptr;
+        std::unordered_map<std::string_view, std::unique_ptr<Node>> children;
+        /// Children whose chunks contain wildcards, they are also stored in `children`.
+        std::vector<Node*> wild_children;
+        std::string key_expr;
+        std::optional<T> value;
+    };
+
+    /// Held by pointer, so that the parent pointers of its children remain valid when the tree is moved.
+    std::unique_ptr<Node> _root = std::make_unique<Node>();
+    size_t _size = 0;
+
+    friend class KeyExprMatcher;
+
+    /// Buffers used by lookups, they can be reused to avoid allocations.
+    struct WalkBuffers {
+        std::vector<std::string_view> query;
+        /// For each depth, flags of query chunk indices reachable by the path to the node at this depth.
+        std::vector<std::vector<char>> states;
+        /// For each depth, chunks of children to look up when query chunks reachable at this depth are not wild.
+        std::vector<std::vector<std::string_view>> lookups;
+        /// Table of `$*` chunk comparisons, for chunks too long for it to fit on the stack.
+        std::vector<char> sub_wild;
+    };
+
+    template <class N, class F>
+    class Walker {
+        using Value = std::conditional_t<std::is_const_v<N>, const T, T>;
+
+        KeyExprTreeQuery _kind;
+        std::vector<std::string_view>& _query;
+        std::vector<std::vector<char>>& _states;
+        std::vector<std::vector<std::string_view>>& _lookups;
+        std::vector<char>& _sub_wild;
+        F& _f;
+
+        size_t query_len() const { return _query.size(); }
+
+        bool is_double_wild(size_t j) const {
+            return j < query_len() && _query[j] == detail::keyexpr_chunks::DOUBLE_WILD;
+        }
+
+        /// Stored key expressions are matched against query `**` chunks skipping them (i.e. matching zero chunks).
+        void close(std::vector<char>& s) const {
+            if (_kind == KeyExprTreeQuery::INCLUDING) return;
+            for (size_t j = 0; j < query_len(); j++) {
+                if (s[j] && is_double_wild(j)) s[j + 1] = 1;
+            }
+        }
+
+        /// Compute query states reachable after matching stored chunk `c`. Return `false` if there are none.
+        bool step(const std::vector<char>& s, std::string_view c, std::vector<char>& out) const {
+            namespace kc = detail::keyexpr_chunks;
+            std::fill(out.begin(), out.end(), 0);
+            bool any = false;
+            const bool double_wild = (c == kc::DOUBLE_WILD);
+            for (size_t j = 0; j <= query_len(); j++) {
+                if (!s[j]) continue;
+                if (double_wild) {
+                    if (_kind == KeyExprTreeQuery::INCLUDED_BY) {
+                        if (is_double_wild(j)) out[j] = any = true;
+                    } else {
+                        // stored `**` matches any number of query chunks, up to the next verbatim one
+                        size_t k = j;
+                        out[k] = any = true;
+                        while (k < query_len() && !kc::is_verbatim(_query[k])) out[++k] = 1;
+                    }
+                } else if (j < query_len()) {
+                    if (is_double_wild(j)) {
+                        if (_kind != KeyExprTreeQuery::INCLUDING && !kc::is_verbatim(c)) out[j] = any = true;
+                    } else if (_kind == KeyExprTreeQuery::INTERSECTING ? kc::intersects(_query[j], c, &_sub_wild)
+                               : _kind == KeyExprTreeQuery::INCLUDED_BY ? kc::includes(_query[j], c, &_sub_wild)
+                                                                        : kc::includes(c, _query[j], &_sub_wild)) {
+                        out[j + 1] = any = true;
+                    }
+                }
+            }
+            if (any) close(out);
+            return any;
+        }
+
+        /// Collect chunks of query reachable at `depth`. Return `false` if some of them are wild, in which case
+        /// stored chunks can not be simply looked up.
+        bool collect_lookups(size_t depth) {
+            if (_lookups.size() <= depth) _lookups.resize(depth + 1);
+            auto& lookups = _lookups[depth];
+            lookups.clear();
+            for (size_t j = 0; j < query_len(); j++) {
+                if (!_states[depth][j]) continue;
+                if (detail::keyexpr_chunks::is_wild(_query[j])) return false;
+                bool found = false;
+                for (auto l : lookups) found = found || (l == _query[j]);
+                if (!found) lookups.push_back(_query[j]);
+            }
+            return true;
+        }
+
+        void visit_child(N& child, size_t depth) {
+            if (_states.size() <= depth + 1) _states.emplace_back();
+            _states[depth + 1].resize(query_len() + 1);
+            if (step(_states[depth], child.chunk, _states[depth + 1])) visit(child, depth + 1);
+        }
+
+        void visit(N& node, size_t depth) {
+            if (node.value.has_value() && _states[depth][query_len()]) {
+                _f(std::string_view(node.key_expr), static_cast<Value&>(*node.value));
+            }
+            if (node.children.empty()) return;
+            if (collect_lookups(depth)) {
+                // non-wild stored chunks can only match identical query chunks
+                for (size_t i = 0; i < _lookups[depth].size(); i++) {
+                    auto it = node.children.find(_lookups[depth][i]);
+                    if (it != node.children.end()) visit_child(*it->second, depth);
+                }
+                for (auto* c : node.wild_children) visit_child(*c, depth);
+            } else {
+                for (auto& [chunk, child] : node.children) visit_child(*child, depth);
+            }
+        }
+
+       public:
+        Walker(KeyExprTreeQuery kind, std::string_view key_expr, F& f, WalkBuffers& buffers)
+            : _kind(kind),
+              _query(buffers.query),
+              _states(buffers.states),
+              _lookups(buffers.lookups),
+              _sub_wild(buffers.sub_wild),
+              _f(f) {
+            detail::keyexpr_chunks::split(key_expr, _query);
+            if (_states.empty()) _states.emplace_back();
+            _states[0].assign(query_len() + 1, 0);
+            _states[0][0] = 1;
+            close(_states[0]);
+        }
+
+        void run(N& root) { visit(root, 0); }
+    };
+
+    Node* find(std::string_view key_expr) const {
+        const Node* node = _root.get();
+        size_t start = 0;
+        while (node != nullptr && start <= key_expr.size()) {
+            size_t end = key_expr.find('/', start);
+            if (end == std::string_view::npos) end = key_expr.size();
+            auto it = node->children.find(key_expr.substr(start, end - start));
+            node = (it == node->children.end()) ? nullptr : it->second.get();
+            start = end + 1;
+        }
+        return const_cast<Node*>(node);
+    }
+
+    template <class V>
+    bool insert_value(const KeyExprView& key_expr, V&& value) {
+        std::string_view k = key_expr.as_string_view();
+        Node* node = _root.get();
+        size_t start = 0;
+        while (start <= k.size()) {
+            size_t end = k.find('/', start);
+            if (end == std::string_view::npos) end = k.size();
+            std::string_view chunk = k.substr(start, end - start);
+            auto it = node->children.find(chunk);
+            if (it == node->children.end()) {
+                auto child = std::make_unique<Node>();
+                child->chunk = std::string(chunk);
+                child->parent = node;
+                if (detail::keyexpr_chunks::is_wild(chunk)) node->wild_children.push_back(child.get());
+                it = node->children.emplace(std::string_view(child->chunk), std::move(child)).first;
+            }
+            node = it->second.get();
+            start = end + 1;
+        }
+        bool inserted = !node->value.has_value();
+        if (inserted) {
+            node->key_expr = std::string(k);
+            _size++;
+        }
+        node->value = std::forward<V>(value);
+        return inserted;
+    }
+
+   public:
+    /// @name Constructors
+
+    /// @brief Construct an empty tree.
+    KeyExprTree() = default;
+
+    /// @brief Move constructor, ``other`` is left empty.
+    KeyExprTree(KeyExprTree&& other)
+        : _root(std::exchange(other._root, std::make_unique<Node>())), _size(std::exchange(other._size, 0)) {}
+
+    KeyExprTree(const KeyExprTree&) = delete;
+
+    /// @name Operators
+
+    /// @brief Move assignment operator, ``other`` is left empty.
+    KeyExprTree& operator=(KeyExprTree&& other) {
+        if (this != &other) {
+            _root = std::exchange(other._root, std::make_unique<Node>());
+            _size = std::exchange(other._size, 0);
+        }
+        return *this;
+    }
+    KeyExprTree& operator=(const KeyExprTree&) = delete;
+
+    /// @name Methods
+
+    /// @brief Associate a value to the key expression, replacing the previous one if any.
+    /// @param key_expr key expression.
+    /// @param value value to associate to the key expression.
+    /// @return ``true`` if the key expression was not yet present in the tree, ``false`` otherwise.
+    bool insert(const KeyExprView& key_expr, const T& value) { return insert_value(key_expr, value); }
+
+    /// @brief Associate a value to the key expression, replacing the previous one if any.
+    /// @param key_expr key expression, it may reference data owned by ``value`` (e.g. ``Sample::get_keyexpr``), since
+    /// ``value`` is only moved from after the key expression has been copied into the tree.
+    /// @param value value to associate to the key expression.
+    /// @return ``true`` if the key expression was not yet present in the tree, ``false`` otherwise.
+    bool insert(const KeyExprView& key_expr, T&& value) { return insert_value(key_expr, std::move(value)); }
+
+    /// @brief Get the value associated to the key expression.
+    /// @param key_expr key expression.
+    /// @return pointer to the value associated to the key expression, or ``nullptr`` if there is none.
+    T* get(const KeyExprView& key_expr) {
+        Node* node = find(key_expr.as_string_view());
+        return (node != nullptr && node->value.has_value()) ? &*node->value : nullptr;
+    }
+
+    /// @brief Get the value associated to the key expression.
+    /// @param key_expr key expression.
+    /// @return pointer to the value associated to the key expression, or ``nullptr`` if there is none.
+    const T* get(const KeyExprView& key_expr) const { return const_cast<KeyExprTree*>(this)->get(key_expr); }
+
+    /// @brief Remove the key expression and its associated value from the tree.
+    /// @param key_expr key expression.
+    /// @return ``true`` if the key expression was present in the tree, ``false`` otherwise.
+    bool erase(const KeyExprView& key_expr) {
+        Node* node = find(key_expr.as_string_view());
+        if (node == nullptr || !node->value.has_value()) return false;
+        node->value.reset();
+        node->key_expr.clear();
+        _size--;
+        while (node != _root.get() && !node->value.has_value() && node->children.empty()) {
+            Node* parent = node->parent;
+            auto& wild = parent->wild_children;
+            for (size_t i = 0; i < wild.size(); i++) {
+                if (wild[i] == node) {
+                    wild.erase(wild.begin() + static_cast<std::ptrdiff_t>(i));
+                    break;
+                }
+            }
+            parent->children.erase(std::string_view(node->chunk));
+            node = parent;
+        }
+        return true;
+    }
+
+    /// @brief Remove all key expressions from the tree.
+    void clear() {
+        _root->children.clear();
+        _root->wild_children.clear();
+        _size = 0;
+    }
+
+    /// @brief Get the number of key expressions stored in the tree.
+    size_t size() const { return _size; }
+
+    /// @brief Check if the tree is empty.
+    bool empty() const { return _size == 0; }
+
+    /// @brief Call ``f`` on each stored key expression which is in relation ``kind`` with ``key_expr``.
+    /// @param kind relation between stored key expressions and ``key_expr``.
+    /// @param key_expr key expression to match stored key expressions against.
+    /// @param f callable with signature ``void f(std::string_view key_expr, T& value)``.
+    template <class F>
+    void query(KeyExprTreeQuery kind, const KeyExprView& key_expr, F&& f) {
+        WalkBuffers buffers;
+        Walker<Node, F> w(kind, key_expr.as_string_view(), f, buffers);
+        w.run(*_root);
+    }
+
+    /// @brief Call ``f`` on each stored key expression which is in relation ``kind`` with ``key_expr``.
+    /// @param kind relation between stored key expressions and ``key_expr``.
+    /// @param key_expr key expression to match stored key expressions against.
+    /// @param f callable with signature ``void f(std::string_view key_expr, const T& value)``.
+    template <class F>
+    void query(KeyExprTreeQuery kind, const KeyExprView& key_expr, F&& f) const {
+        WalkBuffers buffers;
+        Walker<const Node, F> w(kind, key_expr.as_string_view(), f, buffers);
+        w.run(*_root);
+    }
+
+    /// @brief Call ``f`` on each stored key expression intersecting with ``key_expr``.
+    /// @param key_expr key expression.
+    /// @param f callable with signature ``void f(std::string_view key_expr, T& value)``.
+    template <class F>
+    void intersecting(const KeyExprView& key_expr, F&& f) {
+        query(KeyExprTreeQuery::INTERSECTING, key_expr, std::forward<F>(f));
+    }
+
+    /// @brief Call ``f`` on each stored key expression intersecting with ``key_expr``.
+    /// @param key_expr key expression.
+    /// @param f callable with signature ``void f(std::string_view key_expr, const T& value)``.
+    template <class F>
+    void intersecting(const KeyExprView& key_expr, F&& f) const {
+        query(KeyExprTreeQuery::INTERSECTING, key_expr, std::forward<F>(f));
+    }
+
+    /// @brief Call ``f`` on each stored key expression included by ``key_expr``.
+    /// @param key_expr key expression.
+    /// @param f callable with signature ``void f(std::string_view key_expr, T& value)``.
+    template <class F>
+    void included_by(const KeyExprView& key_expr, F&& f) {
+        query(KeyExprTreeQuery::INCLUDED_BY, key_expr, std::forward<F>(f));
+    }
+
+    /// @brief Call ``f`` on each stored key expression included by ``key_expr``.
+    /// @param key_expr key expression.
+    /// @param f callable with signature ``void f(std::string_view key_expr, const T& value)``.
+    template <class F>
+    void included_by(const KeyExprView& key_expr, F&& f) const {
+        query(KeyExprTreeQuery::INCLUDED_BY, key_expr, std::forward<F>(f));
+    }
+
+    /// @brief Call ``f`` on each stored key expression including ``key_expr``.
+    /// @param key_expr key expression.
+    /// @param f callable with signature ``void f(std::string_view key_expr, T& value)``.
+    template <class F>
+    void including(const KeyExprView& key_expr, F&& f) {
+        query(KeyExprTreeQuery::INCLUDING, key_expr, std::forward<F>(f));
+    }
+
+    /// @brief Call ``f`` on each stored key expression including ``key_expr``.
+    /// @param key_expr key expression.
+    /// @param f callable with signature ``void f(std::string_view key_expr, const T& value)``.
+    template <class F>
+    void including(const KeyExprView& key_expr, F&& f) const {
+        query(KeyExprTreeQuery::INCLUDING, key_expr, std::forward<F>(f));
+    }
+};
+
+/// @brief A set of key expressions compiled for matching all of them against a key expression at once.
+///
+/// Key expressions added to the matcher are identified by their index, in order of addition. Matching walks a
+/// ``KeyExprTree`` of the added key expressions in a single pass, and reuses its internal buffers across calls, so that
+/// matching does not allocate once the buffers are large enough. The matcher is thus not thread-safe.
+class KeyExprMatcher {
+    KeyExprTree<size_t> _tree;
+    KeyExprTree<size_t>::WalkBuffers _buffers;
+    size_t _size = 0;
+
+   public:
+    /// @name Constructors
+
+    /// @brief Construct an empty matcher.
+    KeyExprMatcher() = default;
+
+    /// @name Methods
+
+    /// @brief Add a key expression to the matcher.
+    /// @param key_expr key expression.
+    /// @return index of the key expression. If it was already added, the index returned by the previous call.
+    size_t add(const KeyExprView& key_expr) {
+        if (const size_t* index = this->_tree.get(key_expr); index != nullptr) return *index;
+        this->_tree.insert(key_expr, this->_size);
+        return this->_size++;
+    }
+
+    /// @brief Get the number of distinct key expressions added to the matcher.
+    size_t size() const { return this->_size; }
+
+    /// @brief Find all added key expressions which are in relation ``kind`` with ``key_expr``.
+    /// @param key_expr key expression to match added key expressions against.
+    /// @param out vector receiving the indices of matching key expressions, in unspecified order. It is cleared first.
+    /// @param kind relation between added key expressions and ``key_expr``.
+    void match(const KeyExprView& key_expr, std::vector<size_t>& out,
+               KeyExprTreeQuery kind = KeyExprTreeQuery::INTERSECTING) {
+        out.clear();
+        auto f = [&out](std::string_view, const size_t& index) { out.push_back(index); };
+        KeyExprTree<size_t>::Walker<const KeyExprTree<size_t>::Node, decltype(f)> w(kind, key_expr.as_string_view(), f,
+                                                                                     this->_buffers);
+        w.run(*this->_tree._root);
+    }
+};
+
+}  // namespace zenoh
@@ -0,0 +1,461 @@
+//
+// Copyright (c) 2024 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <variant>
+
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <climits>
+#endif
+
+#include "../detail/closures_concrete.hxx"
+#include "../detail/ring_queues.hxx"
+#include "channels.hxx"
+#include "interop.hxx"
+
+namespace zenoh::channels {
+
+namespace detail {
+#if defined(__linux__)
+/// Wakes up threads waiting for data in a channel handler using futex syscalls.
+class FutexNotifier {
+    std::atomic<uint32_t> _events{0};
+    std::atomic<uint32_t> _waiters{0};
+    static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t) && std::atomic<uint32_t>::is_always_lock_free);
+
+    uint32_t* _futex() { return reinterpret_cast<uint32_t*>(&_events); }
+
+   public:
+    /// Signal that new data entry was pushed into the channel, or that the channel was closed.
+    void notify() {
+        _events.fetch_add(1);
+        if (_waiters.load() != 0) {
+            ::syscall(SYS_futex, _futex(), FUTEX_WAKE_PRIVATE, INT_MAX, nullptr, nullptr, 0);
+        }
+    }
+
+    /// Number of signals received so far (modulo 2^32).
+    uint64_t events() const { return _events.load(); }
+
+    /// Wait until the number of signals differs from `seen`. Might return spuriously.
+    void wait(uint64_t seen) {
+        _waiters.fetch_add(1);
+        ::syscall(SYS_futex, _futex(), FUTEX_WAIT_PRIVATE, static_cast<uint32_t>(seen), nullptr, nullptr, 0);
+        _waiters.fetch_sub(1);
+    }
+
+    /// Wait until the number of signals differs from `seen`, or until deadline expires. Might return spuriously.
+    /// Return `false` on timeout.
+    template <class Clock, class Duration>
+    bool wait_until(uint64_t seen, const std::chrono::time_point<Clock, Duration>& deadline) {
+        auto remaining = std::chrono::duration_cast<std::chrono::nanoseconds>(deadline - Clock::now()).count();
+        if (remaining <= 0) return false;
+        ::timespec ts;
+        ts.tv_sec = static_cast<time_t>(remaining / 1000000000);
+        ts.tv_nsec = static_cast<long>(remaining % 1000000000);
+        _waiters.fetch_add(1);
+        ::syscall(SYS_futex, _futex(), FUTEX_WAIT_PRIVATE, static_cast<uint32_t>(seen), &ts, nullptr, 0);
+        _waiters.fetch_sub(1);
+        return true;
+    }
+};
+using ParkingNotifier = FutexNotifier;
+#else
+using ParkingNotifier = HandlerNotifier;
+#endif
+}  // namespace detail
+
+/// @brief Wait strategy of lock-free channels, which busy-spins until data arrives. Provides the lowest latency at the
+/// cost of fully occupying a cpu core by each waiting thread.
+class SpinWait {
+   public:
+    /// @internal
+    void notify() {}
+    /// @internal
+    uint64_t events() const { return 0; }
+    /// @internal
+    void wait(uint64_t, size_t) { zenoh::detail::cpu_relax(); }
+    /// @internal
+    template <class Clock, class Duration>
+    bool wait_until(uint64_t, size_t, const std::chrono::time_point<Clock, Duration>& deadline) {
+        zenoh::detail::cpu_relax();
+        return Clock::now() < deadline;
+    }
+};
+
+/// @brief Wait strategy of lock-free channels, which spins for a short while and then yields the cpu to other threads
+/// until data arrives.
+class YieldWait {
+    static constexpr size_t spin_count = 64;
+
+   public:
+    /// @internal
+    void notify() {}
+    /// @internal
+    uint64_t events() const { return 0; }
+    /// @internal
+    void wait(uint64_t, size_t iteration) {
+        if (iteration < spin_count) {
+            zenoh::detail::cpu_relax();
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    /// @internal
+    template <class Clock, class Duration>
+    bool wait_until(uint64_t seen, size_t iteration, const std::chrono::time_point<Clock, Duration>& deadline) {
+        wait(seen, iteration);
+        return Clock::now() < deadline;
+    }
+};
+
+/// @brief Wait strategy of lock-free channels, which spins for a short while and then puts the waiting thread to sleep
+/// until data arrives (using futex on Linux, and condition variable on other platforms).
+class BlockingWait {
+    static constexpr size_t spin_count = 128;
+    detail::ParkingNotifier _notifier;
+
+   public:
+    /// @internal
+    void notify() { _notifier.notify(); }
+    /// @internal
+    uint64_t events() const { return _notifier.events(); }
+    /// @internal
+    void wait(uint64_t seen, size_t iteration) {
+        if (iteration < spin_count) {
+            zenoh::detail::cpu_relax();
+        } else {
+            _notifier.wait(seen);
+        }
+    }
+    /// @internal
+    template <class Clock, class Duration>
+    bool wait_until(uint64_t seen, size_t iteration, const std::chrono::time_point<Clock, Duration>& deadline) {
+        if (iteration < spin_count) {
+            zenoh::detail::cpu_relax();
+            return Clock::now() < deadline;
+        }
+        return _notifier.wait_until(seen, deadline);
+    }
+};
+
+namespace detail {
+template <class Queue, class Wait>
+struct LockFreeChannelState {
+    Queue queue;
+    Wait wait;
+    std::atomic<bool> closed{false};
+    std::atomic<bool> handler_dropped{false};
+
+    LockFreeChannelState(size_t capacity) : queue(capacity) {}
+};
+
+/// Closure pushing data entries into the buffer of a lock-free channel.
+template <class T, class Queue, class Wait>
+class LockFreeChannelClosure : public zenoh::detail::closures::IClosure<void, T&> {
+    std::shared_ptr<LockFreeChannelState<Queue, Wait>> _state;
+
+   public:
+    LockFreeChannelClosure(std::shared_ptr<LockFreeChannelState<Queue, Wait>> state) : _state(std::move(state)) {}
+
+    virtual void call(T& v) override {
+        for (size_t i = 0; !_state->queue.try_push(std::move(v)); i++) {
+            if (_state->handler_dropped.load(std::memory_order_relaxed)) return;
+            zenoh::detail::ring_backoff(i);
+        }
+        _state->wait.notify();
+    }
+
+    virtual void drop() override {
+        _state->closed.store(true, std::memory_order_release);
+        _state->wait.notify();
+    }
+};
+}  // namespace detail
+
+template <class Wait>
+class SpscChannel;
+template <class Wait>
+class MpscChannel;
+
+/// @brief A handler of lock-free channel.
+///
+/// Handler methods are not thread-safe: only one thread at a time is allowed to receive data from the handler. Receive
+/// operations on a moved-from handler return ``RecvError::Z_DISCONNECTED``.
+/// @tparam T data entry type.
+/// @tparam Queue lock-free buffer type.
+/// @tparam Wait wait strategy used by blocking receive operations.
+template <class T, class Queue, class Wait>
+class LockFreeHandler {
+    using State = detail::LockFreeChannelState<Queue, Wait>;
+    std::shared_ptr<State> _state;
+
+    LockFreeHandler(size_t capacity) : _state(std::make_shared<State>(capacity)) {}
+
+    void release() {
+        if (_state != nullptr) {
+            _state->handler_dropped.store(true, std::memory_order_relaxed);
+        }
+    }
+
+    template <class Container>
+    size_t drain(Container& out, size_t max_count) const {
+        size_t n = 0;
+        while (n < max_count) {
+            T& v = out.emplace_back(interop::detail::null<T>());
+            if (!_state->queue.try_pop(v)) {
+                out.pop_back();
+                break;
+            }
+            n++;
+        }
+        return n;
+    }
+
+    template <class Container>
+    static std::variant<size_t, RecvError> append(Container& out, std::variant<T, RecvError>&& v) {
+        if (std::holds_alternative<RecvError>(v)) {
+            return std::get<RecvError>(v);
+        }
+        out.emplace_back(std::move(std::get<T>(v)));
+        return size_t(1);
+    }
+
+   public:
+    /// @name Constructors
+
+    /// @brief Move constructor.
+    LockFreeHandler(LockFreeHandler&& other) = default;
+
+    /// @name Operators
+
+    /// @brief Move assignment.
+    LockFreeHandler& operator=(LockFreeHandler&& other) {
+        if (this != &other) {
+            release();
+            _state = std::move(other._state);
+        }
+        return *this;
+    }
+
+    ~LockFreeHandler() { release(); }
+
+    /// @name Methods
+
+    /// @brief Return the maximum number of entries in the handler's buffer (0 for a moved-from handler).
+    size_t capacity() const { return _state != nullptr ? _state->queue.capacity() : 0; }
+
+    /// @brief Fetch a data entry from the handler's buffer. If buffer is empty, will block until new data entry
+    /// arrives.
+    /// @return received data entry, if there were any in the buffer, a receive error otherwise.
+    std::variant<T, RecvError> recv() const {
+        if (_state == nullptr) return RecvError::Z_DISCONNECTED;
+        for (size_t i = 0;; i++) {
+            uint64_t seen = _state->wait.events();
+            auto v = try_recv();
+            if (!std::holds_alternative<RecvError>(v) || std::get<RecvError>(v) != RecvError::Z_NODATA) {
+                return v;
+            }
+            _state->wait.wait(seen, i);
+        }
+    }
+
+    /// @brief Fetch a data entry from the handler's buffer. If buffer is empty, will immediately return.
+    /// @return received data entry, if there were any in the buffer, a receive error otherwise.
+    std::variant<T, RecvError> try_recv() const {
+        if (_state == nullptr) return RecvError::Z_DISCONNECTED;
+        std::variant<T, RecvError> v(interop::detail::null<T>());
+        if (_state->queue.try_pop(std::get<T>(v))) {
+            return v;
+        } else if (!_state->closed.load(std::memory_order_acquire)) {
+            return RecvError::Z_NODATA;
+        } else if (_state->queue.try_pop(std::get<T>(v))) {
+            // entries pushed right before the channel was closed
+            return v;
+        } else {
+            return RecvError::Z_DISCONNECTED;
+        }
+    }
+
+    /// @brief Fetch a data entry from the handler's buffer. If buffer is empty, will block until new data entry
+    /// arrives or until the specified deadline is reached.
+    /// @param deadline time point after which the operation gives up waiting.
+    /// @return received data entry, if there were any in the buffer before the deadline, a receive error otherwise
+    /// (``RecvError::Z_NODATA`` if the deadline expired).
+    template <class Clock, class Duration>
+    std::variant<T, RecvError> recv_until(const std::chrono::time_point<Clock, Duration>& deadline) const {
+        if (_state == nullptr) return RecvError::Z_DISCONNECTED;
+        for (size_t i = 0;; i++) {
+            uint64_t seen = _state->wait.events();
+            auto v = try_recv();
+            if (!std::holds_alternative<RecvError>(v) || std::get<RecvError>(v) != RecvError::Z_NODATA) {
+                return v;
+            }
+            if (!_state->wait.wait_until(seen, i, deadline)) {
+                return try_recv();
+            }
+        }
+    }
+
+    /// @brief Fetch a data entry from the handler's buffer. If buffer is empty, will block until new data entry
+    /// arrives or until the specified timeout elapses.
+    /// @param timeout maximum time to wait for a data entry.
+    /// @return received data entry, if there were any in the buffer before the timeout, a receive error otherwise
+    /// (``RecvError::Z_NODATA`` if the timeout elapsed).
+    template <class Rep, class Period>
+    std::variant<T, RecvError> recv_for(const std::chrono::duration<Rep, Period>& timeout) const {
+        return recv_until(std::chrono::steady_clock::now() + timeout);
+    }
+
+    /// @brief Fetch up to ``max_count`` data entries from the handler's buffer and append them to ``out``. If buffer
+    /// is empty, will block until new data entry arrives, then fetch all immediately available entries (up to
+    /// ``max_count``) without blocking.
+    /// @tparam Container sequence container of ``T`` supporting ``emplace_back``, ``back`` and ``pop_back`` (e.g.
+    /// ``std::vector<T>`` or ``std::deque<T>``).
+    /// @param out container to append received data entries to.
+    /// @param max_count maximum number of data entries to fetch.
+    /// @return number of received data entries, if there were any in the buffer, a receive error otherwise.
+    template <class Container>
+    std::variant<size_t, RecvError> recv_batch(Container& out, size_t max_count) const {
+        if (max_count == 0) return size_t(0);
+        auto res = append(out, recv());
+        if (std::holds_alternative<size_t>(res)) {
+            std::get<size_t>(res) += drain(out, max_count - 1);
+        }
+        return res;
+    }
+
+    /// @brief Fetch up to ``max_count`` data entries from the handler's buffer and append them to ``out``. If buffer
+    /// is empty, will immediately return.
+    /// @tparam Container sequence container of ``T`` supporting ``emplace_back``, ``back`` and ``pop_back`` (e.g.
+    /// ``std::vector<T>`` or ``std::deque<T>``).
+    /// @param out container to append received data entries to.
+    /// @param max_count maximum number of data entries to fetch.
+    /// @return number of received data entries, if there were any in the buffer, a receive error otherwise.
+    template <class Container>
+    std::variant<size_t, RecvError> try_recv_batch(Container& out, size_t max_count) const {
+        if (max_count == 0) return size_t(0);
+        auto res = append(out, try_recv());
+        if (std::holds_alternative<size_t>(res)) {
+            std::get<size_t>(res) += drain(out, max_count - 1);
+        }
+        return res;
+    }
+
+    /// @brief Fetch all data entries currently present in the handler's buffer and append them to ``out``. If buffer
+    /// is empty, will immediately return.
+    /// @tparam Container sequence container of ``T`` supporting ``emplace_back``, ``back`` and ``pop_back`` (e.g.
+    /// ``std::vector<T>`` or ``std::deque<T>``).
+    /// @param out container to append received data entries to.
+    /// @return number of received data entries, if there were any in the buffer, a receive error otherwise.
+    template <class Container>
+    std::variant<size_t, RecvError> try_recv_all(Container& out) const {
+        return try_recv_batch(out, std::numeric_limits<size_t>::max());
+    }
+
+    template <class W>
+    friend class SpscChannel;
+    template <class W>
+    friend class MpscChannel;
+};
+
+namespace detail {
+template <class T, class Queue, class Wait>
+std::pair<typename ClosureData<T>::closure_type, LockFreeHandler<T, Queue, Wait>> make_lockfree_cb_handler_pair(
+    LockFreeHandler<T, Queue, Wait>&& h, std::shared_ptr<LockFreeChannelState<Queue, Wait>> state) {
+    typename ClosureData<T>::closure_type c_closure;
+    auto context = (new LockFreeChannelClosure<T, Queue, Wait>(std::move(state)))->as_context();
+    ClosureData<T>::create(&c_closure, context);
+    return {c_closure, std::move(h)};
+}
+}  // namespace detail
+
+/// @brief A bounded lock-free channel for a single producer and a single consumer.
+///
+/// Data entries are moved from zenoh callback directly into a ring buffer without taking any lock. The channel must
+/// only be used when zenoh callback invocations do not overlap (e.g. a subscriber receiving data from a single
+/// publisher over a single link); use ``MpscChannel`` otherwise.
+/// @tparam Wait wait strategy used by blocking receive operations: ``SpinWait``, ``YieldWait`` or ``BlockingWait``.
+template <class Wait = BlockingWait>
+class SpscChannel {
+    size_t _capacity;
+
+   public:
+    /// @brief Constructor.
+    /// @param capacity maximum number of entries in the buffer of the channel, rounded up to the nearest power of 2.
+    /// When the buffer is full, all new attempts to insert data will spin and then sleep, until an entry is fetched and
+    /// the space is freed in the buffer (or until the handler is dropped).
+    SpscChannel(size_t capacity) : _capacity(capacity) {}
+
+    /// @brief Channel handler type.
+    template <class T>
+    using HandlerType = LockFreeHandler<T, zenoh::detail::SpscRingQueue<T>, Wait>;
+
+    /// @internal
+    /// @brief Convert channel into a pair of zenoh callback and handler for the specified type.
+    /// @tparam T entry type.
+    /// @return a callback-handler pair.
+    template <class T>
+    std::pair<typename detail::ClosureData<T>::closure_type, HandlerType<T>> into_cb_handler_pair() const {
+        HandlerType<T> h(_capacity);
+        auto state = h._state;
+        return detail::make_lockfree_cb_handler_pair(std::move(h), std::move(state));
+    }
+};
+
+/// @brief A bounded lock-free channel for multiple producers and a single consumer.
+///
+/// Data entries are moved from zenoh callbacks directly into a ring buffer without taking any lock. Zenoh callbacks
+/// are allowed to be invoked concurrently from several threads.
+/// @tparam Wait wait strategy used by blocking receive operations: ``SpinWait``, ``YieldWait`` or ``BlockingWait``.
+template <class Wait = BlockingWait>
+class MpscChannel {
+    size_t _capacity;
+
+   public:
+    /// @brief Constructor.
+    /// @param capacity maximum number of entries in the buffer of the channel, rounded up to the nearest power of 2.
+    /// When the buffer is full, all new attempts to insert data will spin and then sleep, until an entry is fetched and
+    /// the space is freed in the buffer (or until the handler is dropped).
+    MpscChannel(size_t capacity) : _capacity(capacity) {}
+
+    /// @brief Channel handler type.
+    template <class T>
+    using HandlerType = LockFreeHandler<T, zenoh::detail::MpscRingQueue<T>, Wait>;
+
+    /// @internal
+    /// @brief Convert channel into a pair of zenoh callback and handler for the specified type.
+    /// @tparam T entry type.
+    /// @return a callback-handler pair.
+    template <class T>
+    std::pair<typename detail::ClosureData<T>::closure_type, HandlerType<T>> into_cb_handler_pair() const {
+        HandlerType<T> h(_capacity);
+        auto state = h._state;
+        return detail::make_lockfree_cb_handler_pair(std::move(h), std::move(state));
+    }
+};
+
+}  // namespace zenoh::channels
@@ -194,7 +194,7 @@ class Publisher : public Owned<::z_owned_publisher_t> {
         ZResult res = ::z_publisher_declare_matching_listener(
             interop::as_loaned_c_ptr(*this), interop::as_owned_c_ptr(m), ::z_move(cb_handler_pair.first));
         if (res != Z_OK && err == nullptr) {
-            ::z_drop(interop::as_moved_c_ptr(cb_handler_pair.second));
+            interop::detail::drop_handler(cb_handler_pair.second);
         }
         __ZENOH_RESULT_CHECK(res, err, "Failed to declare Matching Listener");
         return MatchingListener<typename Channel::template HandlerType<MatchingStatus>>(
@@ -240,5 +240,55 @@ class Publisher : public Owned<::z_owned_publisher_t> {
 #endif
 };
 
+/// @brief A ``Publisher`` holding a default attachment, sent with each message published by
+/// ``AttachingPublisher::put`` unless it is overridden in ``Publisher::PutOptions``.
+///
+/// The attachment is shallow-copied for each message, so a fixed header (e.g. tracing id and schema version) can be
+/// built once and shared by all messages. Together with ``Session::PublisherOptions::encoding``, publishing then only
+/// requires to pass the payload. The attachment replaces the whole attachment of the message, it is not merged with
+/// the one set in ``Publisher::PutOptions``.
+class AttachingPublisher {
+    Publisher _publisher;
+    std::optional<Bytes> _attachment;
+
+   public:
+    /// @name Constructors
+
+    /// @brief Wrap a publisher, constructed by ``Session::declare_publisher``.
+    /// @param publisher publisher to wrap.
+    /// @param attachment default attachment, if empty messages are sent without attachment by default.
+    AttachingPublisher(Publisher&& publisher, std::optional<Bytes>&& attachment = {})
+        : _publisher(std::move(publisher)), _attachment(std::move(attachment)) {}
+
+    /// @name Methods
+
+    /// @brief Publish a message on publisher key expression, with the default attachment unless
+    /// ``options.attachment`` is set.
+    /// @param payload data to publish.
+    /// @param options optional parameters to pass to put operation.
+    /// @param err if not null, the result code will be written to this location, otherwise ZException exception will be
+    /// thrown in case of error.
+    void put(Bytes&& payload, Publisher::PutOptions&& options = Publisher::PutOptions::create_default(),
+             ZResult* err = nullptr) const {
+        if (!options.attachment.has_value() && this->_attachment.has_value()) {
+            options.attachment = this->_attachment->clone();
+        }
+        this->_publisher.put(std::move(payload), std::move(options), err);
+    }
+
+    /// @brief Set the default attachment. Must not be called concurrently with ``AttachingPublisher::put``.
+    /// @param attachment the attachment, if empty messages are sent without attachment by default.
+    void set_attachment(std::optional<Bytes>&& attachment) { this->_attachment = std::move(attachment); }
+
+    /// @brief Get the default attachment.
+    const std::optional<Bytes>& get_attachment() const { return this->_attachment; }
+
+    /// @brief Get the wrapped publisher.
+    const Publisher& get_publisher() const { return this->_publisher; }
+
+    /// @brief Get the wrapped publisher, e.g. to undeclare it with ``std::move(p.get_publisher()).undeclare()``.
+    Publisher& get_publisher() { return this->_publisher; }
+};
+
 }  // namespace zenoh
 #endif
@@ -106,7 +106,8 @@ class Querier : public Owned<::z_owned_querier_t> {
         using Dval = std::remove_reference_t<D>;
         using ClosureType = typename detail::closures::Closure<Cval, Dval, void, Reply&>;
         auto closure = ClosureType::into_context(std::forward<C>(on_reply), std::forward<D>(on_drop));
-        ::z_closure(&c_closure, detail::closures::_zenoh_on_reply_call, detail::closures::_zenoh_on_drop, closure);
+        ::z_closure(&c_closure, detail::closures::_zenoh_on_reply_call_static<ClosureType>,
+                    detail::closures::_zenoh_on_drop_static<ClosureType>, closure);
         ::z_querier_get_options_t opts = interop::detail::Converter::to_c_opts(options);
 
         __ZENOH_RESULT_CHECK(
@@ -133,7 +134,7 @@ class Querier : public Owned<::z_owned_querier_t> {
         ZResult res = ::z_querier_get(interop::as_loaned_c_ptr(*this), parameters.c_str(),
                                       ::z_move(cb_handler_pair.first), &opts);
         if (res != Z_OK && err == nullptr) {
-            ::z_drop(interop::as_moved_c_ptr(cb_handler_pair.second));
+            interop::detail::drop_handler(cb_handler_pair.second);
         }
         __ZENOH_RESULT_CHECK(res, err, "Failed to perform Querier::get operation");
         return std::move(cb_handler_pair.second);
@@ -209,7 +210,7 @@ class Querier : public Owned<::z_owned_querier_t> {
         ZResult res = ::z_querier_declare_matching_listener(interop::as_loaned_c_ptr(*this), interop::as_owned_c_ptr(m),
                                                             ::z_move(cb_handler_pair.first));
         if (res != Z_OK && err == nullptr) {
-            ::z_drop(interop::as_moved_c_ptr(cb_handler_pair.second));
+            interop::detail::drop_handler(cb_handler_pair.second);
         }
         __ZENOH_RESULT_CHECK(res, err, "Failed to declare Matching Listener");
         return MatchingListener<typename Channel::template HandlerType<MatchingStatus>>(
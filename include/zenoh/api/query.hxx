@@ -151,7 +151,7 @@ class Query : public Owned<::z_owned_query_t> {
     /// @param options options to pass to reply operation.
     /// @param err if not null, the result code will be written to this location, otherwise ZException exception will be
     /// thrown in case of error.
-    void reply(const KeyExpr& key_expr, Bytes&& payload, ReplyOptions&& options = ReplyOptions::create_default(),
+    void reply(const KeyExprView& key_expr, Bytes&& payload, ReplyOptions&& options = ReplyOptions::create_default(),
                ZResult* err = nullptr) const {
         auto payload_ptr = interop::as_moved_c_ptr(payload);
         ::z_query_reply_options_t opts;
@@ -231,7 +231,7 @@ class Query : public Owned<::z_owned_query_t> {
     /// @param options: the options to pass to reply del operation.
     /// @param err if not null, the result code will be written to this location, otherwise ZException exception will be
     /// thrown in case of error.
-    void reply_del(const KeyExpr& key_expr, ReplyDelOptions&& options = ReplyDelOptions::create_default(),
+    void reply_del(const KeyExprView& key_expr, ReplyDelOptions&& options = ReplyDelOptions::create_default(),
                    ZResult* err = nullptr) const {
         ::z_query_reply_del_options_t opts;
         z_query_reply_del_options_default(&opts);
@@ -248,7 +248,7 @@ class Session : public Owned<::z_owned_session_t> {
     /// @param err if not null, the result code will be written to this location, otherwise ZException exception will be
     /// thrown in case of error.
     /// @return declared ``KeyExpr`` instance.
-    KeyExpr declare_keyexpr(const KeyExpr& key_expr, ZResult* err = nullptr) const {
+    KeyExpr declare_keyexpr(const KeyExprView& key_expr, ZResult* err = nullptr) const {
         KeyExpr k = interop::detail::null<KeyExpr>();
         __ZENOH_RESULT_CHECK(::z_declare_keyexpr(interop::as_loaned_c_ptr(*this), interop::as_owned_c_ptr(k),
                                                  interop::as_loaned_c_ptr(key_expr)),
@@ -350,7 +350,7 @@ class Session : public Owned<::z_owned_session_t> {
     /// @param err if not null, the result code will be written to this location, otherwise ZException exception will be
     /// thrown in case of error.
     template <class C, class D>
-    void get(const KeyExpr& key_expr, const std::string& parameters, C&& on_reply, D&& on_drop,
+    void get(const KeyExprView& key_expr, const std::string& parameters, C&& on_reply, D&& on_drop,
              GetOptions&& options = GetOptions::create_default(), ZResult* err = nullptr) const {
         static_assert(std::is_invocable_r<void, C, Reply&>::value,
                       "on_reply should be callable with the following signature: void on_reply(zenoh::Reply& reply)");
@@ -361,7 +361,8 @@ class Session : public Owned<::z_owned_session_t> {
         using Dval = std::remove_reference_t<D>;
         using ClosureType = typename detail::closures::Closure<Cval, Dval, void, Reply&>;
         auto closure = ClosureType::into_context(std::forward<C>(on_reply), std::forward<D>(on_drop));
-        ::z_closure(&c_closure, detail::closures::_zenoh_on_reply_call, detail::closures::_zenoh_on_drop, closure);
+        ::z_closure(&c_closure, detail::closures::_zenoh_on_reply_call_static<ClosureType>,
+                    detail::closures::_zenoh_on_drop_static<ClosureType>, closure);
         ::z_get_options_t opts = interop::detail::Converter::to_c_opts(options);
 
         __ZENOH_RESULT_CHECK(::z_get(interop::as_loaned_c_ptr(*this), interop::as_loaned_c_ptr(key_expr),
@@ -380,7 +381,7 @@ class Session : public Owned<::z_owned_session_t> {
     /// thrown in case of error.
     /// @return reply handler.
     template <class Channel>
-    typename Channel::template HandlerType<Reply> get(const KeyExpr& key_expr, const std::string& parameters,
+    typename Channel::template HandlerType<Reply> get(const KeyExprView& key_expr, const std::string& parameters,
                                                       Channel channel,
                                                       GetOptions&& options = GetOptions::create_default(),
                                                       ZResult* err = nullptr) const {
@@ -390,7 +391,7 @@ class Session : public Owned<::z_owned_session_t> {
         ZResult res = ::z_get(interop::as_loaned_c_ptr(*this), interop::as_loaned_c_ptr(key_expr), parameters.c_str(),
                               ::z_move(cb_handler_pair.first), &opts);
         if (res != Z_OK && err == nullptr) {
-            ::z_drop(interop::as_moved_c_ptr(cb_handler_pair.second));
+            interop::detail::drop_handler(cb_handler_pair.second);
         }
         __ZENOH_RESULT_CHECK(res, err, "Failed to perform get operation");
         return std::move(cb_handler_pair.second);
@@ -436,7 +437,7 @@ class Session : public Owned<::z_owned_session_t> {
     /// thrown in case of error.
     /// @return a ``Queryable`` object.
     template <class C, class D>
-    [[nodiscard]] Queryable<void> declare_queryable(const KeyExpr& key_expr, C&& on_query, D&& on_drop,
+    [[nodiscard]] Queryable<void> declare_queryable(const KeyExprView& key_expr, C&& on_query, D&& on_drop,
                                                     QueryableOptions&& options = QueryableOptions::create_default(),
                                                     ZResult* err = nullptr) const {
         static_assert(std::is_invocable_r<void, C, Query&>::value,
@@ -448,7 +449,8 @@ class Session : public Owned<::z_owned_session_t> {
         using Dval = std::remove_reference_t<D>;
         using ClosureType = typename detail::closures::Closure<Cval, Dval, void, Query&>;
         auto closure = ClosureType::into_context(std::forward<C>(on_query), std::forward<D>(on_drop));
-        ::z_closure(&c_closure, detail::closures::_zenoh_on_query_call, detail::closures::_zenoh_on_drop, closure);
+        ::z_closure(&c_closure, detail::closures::_zenoh_on_query_call_static<ClosureType>,
+                    detail::closures::_zenoh_on_drop_static<ClosureType>, closure);
         ::z_queryable_options_t opts = interop::detail::Converter::to_c_opts(options);
 
         Queryable<void> q(zenoh::detail::null_object);
@@ -467,7 +469,7 @@ class Session : public Owned<::z_owned_session_t> {
     /// @param err if not null, the result code will be written to this location, otherwise ZException exception will be
     /// thrown in case of error.
     template <class C, class D>
-    void declare_background_queryable(const KeyExpr& key_expr, C&& on_query, D&& on_drop,
+    void declare_background_queryable(const KeyExprView& key_expr, C&& on_query, D&& on_drop,
                                       QueryableOptions&& options = QueryableOptions::create_default(),
                                       ZResult* err = nullptr) const {
         static_assert(std::is_invocable_r<void, C, Query&>::value,
@@ -479,7 +481,8 @@ class Session : public Owned<::z_owned_session_t> {
         using Dval = std::remove_reference_t<D>;
         using ClosureType = typename detail::closures::Closure<Cval, Dval, void, Query&>;
         auto closure = ClosureType::into_context(std::forward<C>(on_query), std::forward<D>(on_drop));
-        ::z_closure(&c_closure, detail::closures::_zenoh_on_query_call, detail::closures::_zenoh_on_drop, closure);
+        ::z_closure(&c_closure, detail::closures::_zenoh_on_query_call_static<ClosureType>,
+                    detail::closures::_zenoh_on_drop_static<ClosureType>, closure);
         ::z_queryable_options_t opts = interop::detail::Converter::to_c_opts(options);
 
         ZResult res = ::z_declare_background_queryable(interop::as_loaned_c_ptr(*this),
@@ -498,7 +501,7 @@ class Session : public Owned<::z_owned_session_t> {
     /// @return a ``Queryable`` object.
     template <class Channel>
     [[nodiscard]] Queryable<typename Channel::template HandlerType<Query>> declare_queryable(
-        const KeyExpr& key_expr, Channel channel, QueryableOptions&& options = QueryableOptions::create_default(),
+        const KeyExprView& key_expr, Channel channel, QueryableOptions&& options = QueryableOptions::create_default(),
         ZResult* err = nullptr) const {
         auto cb_handler_pair = channel.template into_cb_handler_pair<Query>();
         ::z_queryable_options_t opts = interop::detail::Converter::to_c_opts(options);
@@ -507,7 +510,7 @@ class Session : public Owned<::z_owned_session_t> {
         ZResult res = ::z_declare_queryable(interop::as_loaned_c_ptr(*this), interop::as_owned_c_ptr(q),
                                             interop::as_loaned_c_ptr(key_expr), ::z_move(cb_handler_pair.first), &opts);
         if (res != Z_OK && err == nullptr) {
-            ::z_drop(interop::as_moved_c_ptr(cb_handler_pair.second));
+            interop::detail::drop_handler(cb_handler_pair.second);
         }
         __ZENOH_RESULT_CHECK(res, err, "Failed to declare Queryable");
         return Queryable<typename Channel::template HandlerType<Query>>(std::move(q),
@@ -550,7 +553,7 @@ class Session : public Owned<::z_owned_session_t> {
     /// thrown in case of error.
     /// @return a ``Subscriber`` object.
     template <class C, class D>
-    [[nodiscard]] Subscriber<void> declare_subscriber(const KeyExpr& key_expr, C&& on_sample, D&& on_drop,
+    [[nodiscard]] Subscriber<void> declare_subscriber(const KeyExprView& key_expr, C&& on_sample, D&& on_drop,
                                                       SubscriberOptions&& options = SubscriberOptions::create_default(),
                                                       ZResult* err = nullptr) const {
         static_assert(
@@ -563,7 +566,8 @@ class Session : public Owned<::z_owned_session_t> {
         using Dval = std::remove_reference_t<D>;
         using ClosureType = typename detail::closures::Closure<Cval, Dval, void, Sample&>;
         auto closure = ClosureType::into_context(std::forward<C>(on_sample), std::forward<D>(on_drop));
-        ::z_closure(&c_closure, detail::closures::_zenoh_on_sample_call, detail::closures::_zenoh_on_drop, closure);
+        ::z_closure(&c_closure, detail::closures::_zenoh_on_sample_call_static<ClosureType>,
+                    detail::closures::_zenoh_on_drop_static<ClosureType>, closure);
         ::z_subscriber_options_t opts = interop::detail::Converter::to_c_opts(options);
         Subscriber<void> s = interop::detail::null<Subscriber<void>>();
         ZResult res = ::z_declare_subscriber(interop::as_loaned_c_ptr(*this), interop::as_owned_c_ptr(s),
@@ -582,7 +586,7 @@ class Session : public Owned<::z_owned_session_t> {
     /// @param err if not null, the result code will be written to this location, otherwise ZException exception will be
     /// thrown in case of error.
     template <class C, class D>
-    void declare_background_subscriber(const KeyExpr& key_expr, C&& on_sample, D&& on_drop,
+    void declare_background_subscriber(const KeyExprView& key_expr, C&& on_sample, D&& on_drop,
                                        SubscriberOptions&& options = SubscriberOptions::create_default(),
                                        ZResult* err = nullptr) const {
         static_assert(
@@ -595,7 +599,8 @@ class Session : public Owned<::z_owned_session_t> {
         using Dval = std::remove_reference_t<D>;
         using ClosureType = typename detail::closures::Closure<Cval, Dval, void, Sample&>;
         auto closure = ClosureType::into_context(std::forward<C>(on_sample), std::forward<D>(on_drop));
-        ::z_closure(&c_closure, detail::closures::_zenoh_on_sample_call, detail::closures::_zenoh_on_drop, closure);
+        ::z_closure(&c_closure, detail::closures::_zenoh_on_sample_call_static<ClosureType>,
+                    detail::closures::_zenoh_on_drop_static<ClosureType>, closure);
         ::z_subscriber_options_t opts = interop::detail::Converter::to_c_opts(options);
         ZResult res = ::z_declare_background_subscriber(interop::as_loaned_c_ptr(*this),
                                                         interop::as_loaned_c_ptr(key_expr), ::z_move(c_closure), &opts);
@@ -614,7 +619,7 @@ class Session : public Owned<::z_owned_session_t> {
     /// @return a ``Subscriber`` object.
     template <class Channel>
     [[nodiscard]] Subscriber<typename Channel::template HandlerType<Sample>> declare_subscriber(
-        const KeyExpr& key_expr, Channel channel, SubscriberOptions&& options = SubscriberOptions::create_default(),
+        const KeyExprView& key_expr, Channel channel, SubscriberOptions&& options = SubscriberOptions::create_default(),
         ZResult* err = nullptr) const {
         auto cb_handler_pair = channel.template into_cb_handler_pair<Sample>();
         ::z_subscriber_options_t opts = interop::detail::Converter::to_c_opts(options);
@@ -623,7 +628,7 @@ class Session : public Owned<::z_owned_session_t> {
             ::z_declare_subscriber(interop::as_loaned_c_ptr(*this), interop::as_owned_c_ptr(s),
                                    interop::as_loaned_c_ptr(key_expr), ::z_move(cb_handler_pair.first), &opts);
         if (res != Z_OK && err == nullptr) {
-            ::z_drop(interop::as_moved_c_ptr(cb_handler_pair.second));
+            interop::detail::drop_handler(cb_handler_pair.second);
         }
         __ZENOH_RESULT_CHECK(res, err, "Failed to declare Subscriber");
         return Subscriber<typename Channel::template HandlerType<Sample>>(std::move(s),
@@ -661,7 +666,7 @@ class Session : public Owned<::z_owned_session_t> {
     /// @param options options to pass to delete operation.
     /// @param err if not null, the result code will be written to this location, otherwise ZException exception will be
     /// thrown in case of error.
-    void delete_resource(const KeyExpr& key_expr, DeleteOptions&& options = DeleteOptions::create_default(),
+    void delete_resource(const KeyExprView& key_expr, DeleteOptions&& options = DeleteOptions::create_default(),
                          ZResult* err = nullptr) const {
         ::z_delete_options_t opts;
         z_delete_options_default(&opts);
@@ -721,7 +726,7 @@ class Session : public Owned<::z_owned_session_t> {
     /// @param options options to pass to put operation.
     /// @param err if not null, the result code will be written to this location, otherwise ZException exception will be
     /// thrown in case of error.
-    void put(const KeyExpr& key_expr, Bytes&& payload, PutOptions&& options = PutOptions::create_default(),
+    void put(const KeyExprView& key_expr, Bytes&& payload, PutOptions&& options = PutOptions::create_default(),
              ZResult* err = nullptr) const {
         ::z_put_options_t opts;
         z_put_options_default(&opts);
@@ -796,7 +801,7 @@ class Session : public Owned<::z_owned_session_t> {
     /// @param err if not null, the result code will be written to this location, otherwise ZException exception will be
     /// thrown in case of error.
     /// @return a ``Publisher`` object.
-    Publisher declare_publisher(const KeyExpr& key_expr,
+    Publisher declare_publisher(const KeyExprView& key_expr,
                                 PublisherOptions&& options = PublisherOptions::create_default(),
                                 ZResult* err = nullptr) const {
         Publisher p = interop::detail::null<Publisher>();
@@ -846,7 +851,7 @@ class Session : public Owned<::z_owned_session_t> {
     /// @param err if not null, the result code will be written to this location, otherwise ZException exception will be
     /// thrown in case of error.
     /// @return a ``Querier`` object.
-    Querier declare_querier(const KeyExpr& key_expr, QuerierOptions&& options = QuerierOptions::create_default(),
+    Querier declare_querier(const KeyExprView& key_expr, QuerierOptions&& options = QuerierOptions::create_default(),
                             ZResult* err = nullptr) const {
         ::z_querier_options_t opts;
         z_querier_options_default(&opts);
@@ -1059,7 +1064,7 @@ class Session : public Owned<::z_owned_session_t> {
         ZResult res = ::z_declare_transport_events_listener(interop::as_loaned_c_ptr(*this), interop::as_owned_c_ptr(l),
                                                             ::z_move(cb_handler_pair.first), &opts);
         if (res != Z_OK && err == nullptr) {
-            ::z_drop(interop::as_moved_c_ptr(cb_handler_pair.second));
+            interop::detail::drop_handler(cb_handler_pair.second);
         }
         __ZENOH_RESULT_CHECK(res, err, "Failed to declare transport events listener");
         return TransportEventsListener<typename Channel::template HandlerType<TransportEvent>>(
@@ -1181,7 +1186,7 @@ class Session : public Owned<::z_owned_session_t> {
         ZResult res = ::z_declare_link_events_listener(interop::as_loaned_c_ptr(*this), interop::as_owned_c_ptr(l),
                                                        ::z_move(cb_handler_pair.first), &opts);
         if (res != Z_OK && err == nullptr) {
-            ::z_drop(interop::as_moved_c_ptr(cb_handler_pair.second));
+            interop::detail::drop_handler(cb_handler_pair.second);
         }
         __ZENOH_RESULT_CHECK(res, err, "Failed to declare link events listener");
         return LinkEventsListener<typename Channel::template HandlerType<LinkEvent>>(std::move(l),
@@ -1350,7 +1355,7 @@ class Session : public Owned<::z_owned_session_t> {
     /// thrown in case of error.
     /// @return a ``LivelinessToken``.
     LivelinessToken liveliness_declare_token(
-        const KeyExpr& key_expr,
+        const KeyExprView& key_expr,
         LivelinessDeclarationOptions&& options = LivelinessDeclarationOptions::create_default(),
         ZResult* err = nullptr) {
         LivelinessToken t = interop::detail::null<LivelinessToken>();
@@ -1397,7 +1402,7 @@ class Session : public Owned<::z_owned_session_t> {
     /// @return a ``Subscriber`` object.
     template <class C, class D>
     [[nodiscard]] Subscriber<void> liveliness_declare_subscriber(
-        const KeyExpr& key_expr, C&& on_sample, D&& on_drop,
+        const KeyExprView& key_expr, C&& on_sample, D&& on_drop,
         LivelinessSubscriberOptions&& options = LivelinessSubscriberOptions::create_default(),
         ZResult* err = nullptr) const {
         static_assert(
@@ -1410,7 +1415,8 @@ class Session : public Owned<::z_owned_session_t> {
         using Dval = std::remove_reference_t<D>;
         using ClosureType = typename detail::closures::Closure<Cval, Dval, void, Sample&>;
         auto closure = ClosureType::into_context(std::forward<C>(on_sample), std::forward<D>(on_drop));
-        ::z_closure(&c_closure, detail::closures::_zenoh_on_sample_call, detail::closures::_zenoh_on_drop, closure);
+        ::z_closure(&c_closure, detail::closures::_zenoh_on_sample_call_static<ClosureType>,
+                    detail::closures::_zenoh_on_drop_static<ClosureType>, closure);
         ::z_liveliness_subscriber_options_t opts = interop::detail::Converter::to_c_opts(options);
         Subscriber<void> s = interop::detail::null<Subscriber<void>>();
         ZResult res = ::z_liveliness_declare_subscriber(interop::as_loaned_c_ptr(*this), interop::as_owned_c_ptr(s),
@@ -1430,7 +1436,7 @@ class Session : public Owned<::z_owned_session_t> {
     /// @note Zenoh-c only.
     template <class C, class D>
     void liveliness_declare_background_subscriber(
-        const KeyExpr& key_expr, C&& on_sample, D&& on_drop,
+        const KeyExprView& key_expr, C&& on_sample, D&& on_drop,
         LivelinessSubscriberOptions&& options = LivelinessSubscriberOptions::create_default(),
         ZResult* err = nullptr) const {
         static_assert(
@@ -1443,7 +1449,8 @@ class Session : public Owned<::z_owned_session_t> {
         using Dval = std::remove_reference_t<D>;
         using ClosureType = typename detail::closures::Closure<Cval, Dval, void, Sample&>;
         auto closure = ClosureType::into_context(std::forward<C>(on_sample), std::forward<D>(on_drop));
-        ::z_closure(&c_closure, detail::closures::_zenoh_on_sample_call, detail::closures::_zenoh_on_drop, closure);
+        ::z_closure(&c_closure, detail::closures::_zenoh_on_sample_call_static<ClosureType>,
+                    detail::closures::_zenoh_on_drop_static<ClosureType>, closure);
         ::z_liveliness_subscriber_options_t opts = interop::detail::Converter::to_c_opts(options);
         ZResult res = ::z_liveliness_declare_background_subscriber(
             interop::as_loaned_c_ptr(*this), interop::as_loaned_c_ptr(key_expr), ::z_move(c_closure), &opts);
@@ -1461,7 +1468,7 @@ class Session : public Owned<::z_owned_session_t> {
     /// @return a ``Subscriber`` object.
     template <class Channel>
     [[nodiscard]] Subscriber<typename Channel::template HandlerType<Sample>> liveliness_declare_subscriber(
-        const KeyExpr& key_expr, Channel channel,
+        const KeyExprView& key_expr, Channel channel,
         LivelinessSubscriberOptions&& options = LivelinessSubscriberOptions::create_default(),
         ZResult* err = nullptr) const {
         auto cb_handler_pair = channel.template into_cb_handler_pair<Sample>();
@@ -1471,7 +1478,7 @@ class Session : public Owned<::z_owned_session_t> {
                                                         interop::as_loaned_c_ptr(key_expr),
                                                         ::z_move(cb_handler_pair.first), &opts);
         if (res != Z_OK && err == nullptr) {
-            ::z_drop(interop::as_moved_c_ptr(cb_handler_pair.second));
+            interop::detail::drop_handler(cb_handler_pair.second);
         }
         __ZENOH_RESULT_CHECK(res, err, "Failed to declare Liveliness Token Subscriber");
         return Subscriber<typename Channel::template HandlerType<Sample>>(std::move(s),
@@ -1518,7 +1525,7 @@ class Session : public Owned<::z_owned_session_t> {
     /// @param err if not null, the result code will be written to this location, otherwise ZException exception will be
     /// thrown in case of error.
     template <class C, class D>
-    void liveliness_get(const KeyExpr& key_expr, C&& on_reply, D&& on_drop,
+    void liveliness_get(const KeyExprView& key_expr, C&& on_reply, D&& on_drop,
                         LivelinessGetOptions&& options = LivelinessGetOptions::create_default(),
                         ZResult* err = nullptr) const {
         static_assert(std::is_invocable_r<void, C, Reply&>::value,
@@ -1530,7 +1537,8 @@ class Session : public Owned<::z_owned_session_t> {
         using Dval = std::remove_reference_t<D>;
         using ClosureType = typename detail::closures::Closure<Cval, Dval, void, Reply&>;
         auto closure = ClosureType::into_context(std::forward<C>(on_reply), std::forward<D>(on_drop));
-        ::z_closure(&c_closure, detail::closures::_zenoh_on_reply_call, detail::closures::_zenoh_on_drop, closure);
+        ::z_closure(&c_closure, detail::closures::_zenoh_on_reply_call_static<ClosureType>,
+                    detail::closures::_zenoh_on_drop_static<ClosureType>, closure);
         ::z_liveliness_get_options_t opts = interop::detail::Converter::to_c_opts(options);
 
         __ZENOH_RESULT_CHECK(::z_liveliness_get(interop::as_loaned_c_ptr(*this), interop::as_loaned_c_ptr(key_expr),
@@ -1549,7 +1557,7 @@ class Session : public Owned<::z_owned_session_t> {
     /// @return reply handler.
     template <class Channel>
     typename Channel::template HandlerType<Reply> liveliness_get(
-        const KeyExpr& key_expr, Channel channel,
+        const KeyExprView& key_expr, Channel channel,
         LivelinessGetOptions&& options = LivelinessGetOptions::create_default(), ZResult* err = nullptr) const {
         auto cb_handler_pair = channel.template into_cb_handler_pair<Reply>();
         ::z_liveliness_get_options_t opts = interop::detail::Converter::to_c_opts(options);
@@ -1557,7 +1565,7 @@ class Session : public Owned<::z_owned_session_t> {
         ZResult res = ::z_liveliness_get(interop::as_loaned_c_ptr(*this), interop::as_loaned_c_ptr(key_expr),
                                          ::z_move(cb_handler_pair.first), &opts);
         if (res != Z_OK && err == nullptr) {
-            ::z_drop(interop::as_moved_c_ptr(cb_handler_pair.second));
+            interop::detail::drop_handler(cb_handler_pair.second);
         }
         __ZENOH_RESULT_CHECK(res, err, "Failed to perform liveliness_get operation");
         return std::move(cb_handler_pair.second);
@@ -13,15 +13,107 @@
 
 #pragma once
 
+#include <cstddef>
+#include <mutex>
+#include <new>
 #include <type_traits>
 #include <utility>
 
+#include "../api/closures.hxx"
+
 namespace zenoh::detail::closures {
 
+/// Default context allocator: keeps released blocks in per size class free lists for reuse, so that allocation of
+/// short-lived contexts does not reach the heap once the pool is warmed up.
+class ContextPool : public zenoh::closures::ContextAllocator {
+    static constexpr size_t min_block_size = 64;
+    static constexpr size_t num_size_classes = 4;
+    static constexpr size_t max_free_blocks = 1024;
+
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    struct SizeClass {
+        std::mutex mutex;
+        FreeBlock* head = nullptr;
+        size_t count = 0;
+    };
+
+    SizeClass _classes[num_size_classes];
+
+    static size_t size_class(size_t size) {
+        size_t c = 0;
+        for (size_t block_size = min_block_size; block_size < size; block_size <<= 1) c++;
+        return c;
+    }
+
+   public:
+    static ContextPool& instance() {
+        // never destroyed, since contexts might be released during static destruction
+        static ContextPool* pool = new ContextPool();
+        return *pool;
+    }
+
+    void* allocate(size_t size) override {
+        size_t c = size_class(size);
+        if (c >= num_size_classes) return ::operator new(size, std::nothrow);
+        {
+            std::lock_guard<std::mutex> lock(_classes[c].mutex);
+            FreeBlock* b = _classes[c].head;
+            if (b != nullptr) {
+                _classes[c].head = b->next;
+                _classes[c].count--;
+                return b;
+            }
+        }
+        return ::operator new(min_block_size << c, std::nothrow);
+    }
+
+    void deallocate(void* ptr, size_t size) override {
+        size_t c = size_class(size);
+        if (c < num_size_classes) {
+            std::lock_guard<std::mutex> lock(_classes[c].mutex);
+            if (_classes[c].count < max_free_blocks) {
+                _classes[c].head = new (ptr) FreeBlock{_classes[c].head};
+                _classes[c].count++;
+                return;
+            }
+        }
+        ::operator delete(ptr);
+    }
+};
+
+/// Each context block starts with a header storing the allocator which created it.
+union ContextHeader {
+    zenoh::closures::ContextAllocator* allocator;
+    std::max_align_t _align;
+};
+
+inline void* allocate_context(size_t size) {
+    zenoh::closures::ContextAllocator* allocator = zenoh::closures::get_context_allocator();
+    if (allocator == nullptr) allocator = &ContextPool::instance();
+    void* ptr = allocator->allocate(size + sizeof(ContextHeader));
+    if (ptr == nullptr) throw std::bad_alloc();
+    auto header = new (ptr) ContextHeader;
+    header->allocator = allocator;
+    return header + 1;
+}
+
+inline void deallocate_context(void* ptr, size_t size) {
+    auto header = static_cast<ContextHeader*>(ptr) - 1;
+    header->allocator->deallocate(header, size + sizeof(ContextHeader));
+}
+
 struct IDroppable {
     virtual void drop() = 0;
     virtual ~IDroppable(){};
 
+    static void* operator new(size_t size) { return allocate_context(size); }
+    static void operator delete(void* ptr, size_t size) { deallocate_context(ptr, size); }
+    static void* operator new(size_t size, std::align_val_t al) { return ::operator new(size, al); }
+    static void operator delete(void* ptr, size_t size, std::align_val_t al) { ::operator delete(ptr, size, al); }
+
     static void delete_from_context(void* context) {
         reinterpret_cast<IDroppable*>(context)->drop();
         delete reinterpret_cast<IDroppable*>(context);
@@ -61,7 +153,7 @@ class Droppable : public IDroppable {
 };
 
 template <class C, class D, class R, class... Args>
-class Closure : public IClosure<R, Args...> {
+class Closure final : public IClosure<R, Args...> {
     typename std::conditional_t<std::is_lvalue_reference_v<C>, C, std::remove_reference_t<C>> _call;
     typename std::conditional_t<std::is_lvalue_reference_v<D>, D, std::remove_reference_t<D>> _drop;
 
@@ -78,6 +170,19 @@ class Closure : public IClosure<R, Args...> {
         auto obj = new Closure<C, D, R, Args...>(std::forward<CC>(call), std::forward<DD>(drop));
         return obj->as_context();
     }
+
+    /// Call closure from context created by ``into_context`` without virtual dispatch.
+    static R call_from_context(void* context, Args... args) {
+        auto obj = static_cast<Closure*>(reinterpret_cast<IDroppable*>(context));
+        return obj->_call(std::forward<Args>(args)...);
+    }
+
+    /// Drop and delete closure from context created by ``into_context`` without virtual dispatch.
+    static void delete_from_context(void* context) {
+        auto obj = static_cast<Closure*>(reinterpret_cast<IDroppable*>(context));
+        obj->_drop();
+        delete obj;
+    }
 };
 
 }  // namespace zenoh::detail::closures
\ No newline at end of file
@@ -69,4 +69,28 @@ inline void _zenoh_on_link_event_call(::z_loaned_link_event_t* event, void* cont
 }
 #endif
 }
+
+// Trampolines bound to a statically known closure type, so that the user callable can be invoked (and inlined)
+// without going through the virtual ``IClosure::call``. Function templates can not have C language linkage, but their
+// signatures match the ones expected by zenoh-c closures.
+template <class ClosureType>
+void _zenoh_on_drop_static(void* context) {
+    ClosureType::delete_from_context(context);
+}
+#if defined(ZENOHCXX_ZENOHC) || Z_FEATURE_QUERY == 1
+template <class ClosureType>
+void _zenoh_on_reply_call_static(::z_loaned_reply_t* reply, void* context) {
+    ClosureType::call_from_context(context, interop::as_owned_cpp_ref<Reply>(reply));
+}
+#endif
+template <class ClosureType>
+void _zenoh_on_sample_call_static(::z_loaned_sample_t* sample, void* context) {
+    ClosureType::call_from_context(context, interop::as_owned_cpp_ref<Sample>(sample));
+}
+#if defined(ZENOHCXX_ZENOHC) || Z_FEATURE_QUERYABLE == 1
+template <class ClosureType>
+void _zenoh_on_query_call_static(::z_loaned_query_t* query, void* context) {
+    ClosureType::call_from_context(context, interop::as_owned_cpp_ref<Query>(query));
+}
+#endif
 }  // namespace zenoh::detail::closures
@@ -0,0 +1,126 @@
+//
+// Copyright (c) 2024 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+
+#pragma once
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+/// Helpers implementing key expression semantics on chunks of canonical key expressions.
+namespace zenoh::detail::keyexpr_chunks {
+inline constexpr std::string_view DOUBLE_WILD = "**";
+inline constexpr std::string_view WILD = "*";
+
+/// Split canonical key expression into its chunks.
+inline void split(std::string_view key_expr, std::vector<std::string_view>& out) {
+    out.clear();
+    size_t start = 0;
+    while (true) {
+        size_t end = key_expr.find('/', start);
+        if (end == std::string_view::npos) {
+            out.push_back(key_expr.substr(start));
+            return;
+        }
+        out.push_back(key_expr.substr(start, end - start));
+        start = end + 1;
+    }
+}
+
+/// Verbatim chunks (starting with `@`) are only matched by identical chunks, never by wildcards.
+inline bool is_verbatim(std::string_view c) { return !c.empty() && c[0] == '@'; }
+
+/// Check if chunk is `*`, `**` or contains `$*`.
+inline bool is_wild(std::string_view c) { return c.find('*') != std::string_view::npos; }
+
+inline bool is_sub_wild_at(std::string_view c, size_t i) { return i + 1 < c.size() && c[i] == '$' && c[i + 1] == '*'; }
+
+inline size_t next_token(std::string_view c, size_t i) { return is_sub_wild_at(c, i) ? i + 2 : i + 1; }
+
+/// Length of chunk `b` up to which `sub_wild_match` keeps its table on the stack.
+inline constexpr size_t SUB_WILD_STACK_LEN = 63;
+
+/// Check if chunks containing `$*` (matching any, possibly empty, sequence of characters) may match a common string
+/// (if `Inclusion` is `false`), or if `a` matches all strings matched by `b` (if `Inclusion` is `true`).
+///
+/// Only the 3 last rows of the table are kept. They are stored on the stack if `b` is at most `SUB_WILD_STACK_LEN`
+/// characters long, and otherwise in `scratch` (or in a temporary buffer if `scratch` is null).
+template <bool Inclusion>
+bool sub_wild_match(std::string_view a, std::string_view b, std::vector<char>* scratch) {
+    const size_t na = a.size(), nb = b.size(), w = nb + 1;
+    char stack[3 * (SUB_WILD_STACK_LEN + 1)];
+    std::vector<char> tmp;
+    char* rows = stack;
+    if (w > SUB_WILD_STACK_LEN + 1) {
+        if (scratch == nullptr) scratch = &tmp;
+        scratch->resize(3 * w);
+        rows = scratch->data();
+    }
+    auto at = [rows, w](size_t i, size_t j) -> char& { return rows[(i % 3) * w + j]; };
+    for (size_t i = na + 1; i-- > 0;) {
+        for (size_t j = nb + 1; j-- > 0;) {
+            bool res;
+            if (i == na && (Inclusion || j == nb)) {
+                res = (j == nb);
+            } else if (i < na && is_sub_wild_at(a, i)) {
+                res = at(i + 2, j) || (j < nb && at(i, next_token(b, j)));
+            } else if (j < nb && is_sub_wild_at(b, j)) {
+                res = !Inclusion && (at(i, j + 2) || (i < na && at(next_token(a, i), j)));
+            } else {
+                res = i < na && j < nb && a[i] == b[j] && at(i + 1, j + 1);
+            }
+            at(i, j) = res;
+        }
+    }
+    return at(0, 0);
+}
+
+/// Check if chunks (other than `**`) intersect.
+inline bool intersects(std::string_view a, std::string_view b, std::vector<char>* scratch = nullptr) {
+    if (a == b) return true;
+    if (is_verbatim(a) || is_verbatim(b)) return false;
+    if (a == WILD || b == WILD) return true;
+    if (a.find('$') == std::string_view::npos && b.find('$') == std::string_view::npos) return false;
+    return sub_wild_match<false>(a, b, scratch);
+}
+
+/// Check if chunk `a` includes chunk `b` (both other than `**`).
+inline bool includes(std::string_view a, std::string_view b, std::vector<char>* scratch = nullptr) {
+    if (a == b) return true;
+    if (is_verbatim(a) || is_verbatim(b)) return false;
+    if (a == WILD) return true;
+    if (b == WILD || a.find('$') == std::string_view::npos) return false;
+    return sub_wild_match<true>(a, b, scratch);
+}
+
+/// Get the chunk of key expression `k` starting at offset `pos`.
+inline std::string_view chunk_at(std::string_view k, size_t pos) {
+    size_t end = k.find('/', pos);
+    return k.substr(pos, end == std::string_view::npos ? end : end - pos);
+}
+
+/// Check if key expression `a` includes key expression `b`, starting from chunks at offsets `i` and `j` (an offset
+/// past the end of the string means that all chunks were consumed).
+inline bool keyexpr_includes(std::string_view a, std::string_view b, size_t i = 0, size_t j = 0) {
+    if (i > a.size()) return j > b.size();
+    std::string_view ca = chunk_at(a, i);
+    if (ca == DOUBLE_WILD) {
+        if (keyexpr_includes(a, b, i + ca.size() + 1, j)) return true;
+        if (j > b.size()) return false;
+        std::string_view cb = chunk_at(b, j);
+        return !is_verbatim(cb) && keyexpr_includes(a, b, i, j + cb.size() + 1);
+    }
+    if (j > b.size()) return false;
+    std::string_view cb = chunk_at(b, j);
+    return cb != DOUBLE_WILD && includes(ca, cb) && keyexpr_includes(a, b, i + ca.size() + 1, j + cb.size() + 1);
+}
+}  // namespace zenoh::detail::keyexpr_chunks
@@ -0,0 +1,193 @@
+//
+// Copyright (c) 2024 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <thread>
+#include <utility>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#endif
+
+namespace zenoh::detail {
+
+/// Assumed size of the cache line, used to keep producer and consumer indices apart.
+inline constexpr size_t cache_line_size = 64;
+
+/// Hint the cpu that the calling thread is busy-waiting.
+inline void cpu_relax() {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    _mm_pause();
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    __builtin_ia32_pause();
+#elif (defined(__GNUC__) || defined(__clang__)) && defined(__aarch64__)
+    __asm__ __volatile__("yield");
+#endif
+}
+
+/// Back off after `iteration` unsuccessful attempts to push into a full queue.
+inline void ring_backoff(size_t iteration) {
+    if (iteration < 64) {
+        cpu_relax();
+    } else if (iteration < 1024) {
+        std::this_thread::yield();
+    } else {
+        std::this_thread::sleep_for(std::chrono::microseconds(50));
+    }
+}
+
+/// Round capacity up to the nearest power of 2 (at least 1).
+inline size_t ring_capacity(size_t capacity) {
+    size_t c = 1;
+    while (c < capacity) c <<= 1;
+    return c;
+}
+
+/// Uninitialized storage for a single ring buffer entry.
+template <class T>
+struct RingSlot {
+    alignas(T) unsigned char data[sizeof(T)];
+    T* get() { return std::launder(reinterpret_cast<T*>(data)); }
+};
+
+/// Bounded lock-free queue for a single producer and a single consumer.
+template <class T>
+class SpscRingQueue {
+    size_t _mask;
+    std::unique_ptr<RingSlot<T>[]> _slots;
+    // consumer side
+    alignas(cache_line_size) std::atomic<size_t> _head{0};
+    size_t _tail_cached = 0;
+    // producer side
+    alignas(cache_line_size) std::atomic<size_t> _tail{0};
+    size_t _head_cached = 0;
+
+   public:
+    explicit SpscRingQueue(size_t capacity)
+        : _mask(ring_capacity(capacity) - 1), _slots(new RingSlot<T>[_mask + 1]) {}
+
+    SpscRingQueue(const SpscRingQueue&) = delete;
+    SpscRingQueue& operator=(const SpscRingQueue&) = delete;
+
+    ~SpscRingQueue() {
+        for (size_t i = _head.load(std::memory_order_relaxed); i != _tail.load(std::memory_order_relaxed); i++) {
+            _slots[i & _mask].get()->~T();
+        }
+    }
+
+    size_t capacity() const { return _mask + 1; }
+
+    /// Move v into the queue. Return false (leaving v untouched) if the queue is full. Producer only.
+    bool try_push(T&& v) {
+        size_t tail = _tail.load(std::memory_order_relaxed);
+        if (tail - _head_cached > _mask) {
+            _head_cached = _head.load(std::memory_order_acquire);
+            if (tail - _head_cached > _mask) return false;
+        }
+        new (_slots[tail & _mask].data) T(std::move(v));
+        _tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// Move the oldest entry into out. Return false if the queue is empty. Consumer only.
+    bool try_pop(T& out) {
+        size_t head = _head.load(std::memory_order_relaxed);
+        if (head == _tail_cached) {
+            _tail_cached = _tail.load(std::memory_order_acquire);
+            if (head == _tail_cached) return false;
+        }
+        T* v = _slots[head & _mask].get();
+        out = std::move(*v);
+        v->~T();
+        _head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+};
+
+/// Bounded lock-free queue for multiple producers and a single consumer.
+template <class T>
+class MpscRingQueue {
+    struct Cell {
+        std::atomic<size_t> sequence;
+        RingSlot<T> slot;
+    };
+    size_t _mask;
+    std::unique_ptr<Cell[]> _cells;
+    // producers side
+    alignas(cache_line_size) std::atomic<size_t> _tail{0};
+    // consumer side
+    alignas(cache_line_size) size_t _head = 0;
+
+   public:
+    explicit MpscRingQueue(size_t capacity) : _mask(ring_capacity(capacity) - 1), _cells(new Cell[_mask + 1]) {
+        for (size_t i = 0; i <= _mask; i++) {
+            _cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MpscRingQueue(const MpscRingQueue&) = delete;
+    MpscRingQueue& operator=(const MpscRingQueue&) = delete;
+
+    ~MpscRingQueue() {
+        for (size_t i = _head;; i++) {
+            Cell& c = _cells[i & _mask];
+            if (c.sequence.load(std::memory_order_relaxed) != i + 1) break;
+            c.slot.get()->~T();
+        }
+    }
+
+    size_t capacity() const { return _mask + 1; }
+
+    /// Move v into the queue. Return false (leaving v untouched) if the queue is full. Thread-safe.
+    bool try_push(T&& v) {
+        size_t pos = _tail.load(std::memory_order_relaxed);
+        Cell* c;
+        while (true) {
+            c = &_cells[pos & _mask];
+            size_t seq = c->sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::ptrdiff_t>(seq - pos);
+            if (diff == 0) {
+                if (_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = _tail.load(std::memory_order_relaxed);
+            }
+        }
+        new (c->slot.data) T(std::move(v));
+        c->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// Move the oldest entry into out. Return false if the queue is empty, or if the producer which claimed the oldest
+    /// entry has not finished writing it yet. Consumer only.
+    bool try_pop(T& out) {
+        Cell& c = _cells[_head & _mask];
+        if (c.sequence.load(std::memory_order_acquire) != _head + 1) return false;
+        T* v = c.slot.get();
+        out = std::move(*v);
+        v->~T();
+        c.sequence.store(_head + _mask + 1, std::memory_order_release);
+        _head++;
+        return true;
+    }
+};
+
+}  // namespace zenoh::detail
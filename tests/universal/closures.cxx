@@ -18,6 +18,8 @@ using namespace zenoh;
 #include <assert.h>
 
 #include <iostream>
+#include <string>
+#include <vector>
 
 void test_call_drop() {
     size_t calls_count = 0;
@@ -62,7 +64,92 @@ void test_context() {
     assert(dropped);
 }
 
+void test_context_pool_reuse() {
+    auto on_call = [](size_t c) { return c; };
+    using OnCall = decltype(on_call);
+    using ClosureType = detail::closures::Closure<OnCall, closures::None, size_t, size_t>;
+
+    auto context = ClosureType::into_context(on_call, closures::none);
+    detail::closures::IDroppable::delete_from_context(context);
+    auto context2 = ClosureType::into_context(on_call, closures::none);
+    assert(context2 == context);
+    assert(detail::closures::IClosure<size_t, size_t>::call_from_context(context2, 5) == 5);
+    detail::closures::IDroppable::delete_from_context(context2);
+}
+
+class CountingAllocator : public closures::ContextAllocator {
+   public:
+    size_t allocated = 0;
+    size_t deallocated = 0;
+
+    void* allocate(size_t size) override {
+        allocated++;
+        return ::operator new(size);
+    }
+
+    void deallocate(void* ptr, size_t size) override {
+        (void)size;
+        deallocated++;
+        ::operator delete(ptr);
+    }
+};
+
+void test_custom_context_allocator() {
+    CountingAllocator allocator;
+    closures::set_context_allocator(&allocator);
+    assert(closures::get_context_allocator() == &allocator);
+
+    bool dropped = false;
+    auto on_call = [](size_t c) { return c; };
+    using OnCall = decltype(on_call);
+    auto on_drop = [&dropped] { dropped = true; };
+    using OnDrop = decltype(on_drop);
+
+    auto context = detail::closures::Closure<OnCall, OnDrop, size_t, size_t>::into_context(on_call, on_drop);
+    assert(allocator.allocated == 1);
+    {
+        Bytes b(std::vector<uint8_t>{1, 2, 3});
+        assert(allocator.allocated == 2);
+        Bytes s(std::string("abc"));
+        assert(allocator.allocated == 3);
+        assert(s.as_string() == "abc");
+    }
+    assert(allocator.deallocated == 2);
+
+    // context is released by the allocator which created it
+    closures::set_context_allocator(nullptr);
+    detail::closures::IDroppable::delete_from_context(context);
+    assert(dropped);
+    assert(allocator.deallocated == 3);
+    {
+        Bytes b(std::vector<uint8_t>{1, 2, 3});
+        assert(b.as_vector() == std::vector<uint8_t>({1, 2, 3}));
+    }
+    assert(allocator.allocated == 3);
+}
+
+void test_static_dispatch() {
+    size_t calls_count = 0;
+    bool dropped = false;
+
+    auto on_call = [&calls_count](size_t c) { calls_count += c; };
+    using OnCall = decltype(on_call);
+    auto on_drop = [&dropped] { dropped = true; };
+    using OnDrop = decltype(on_drop);
+    using ClosureType = detail::closures::Closure<OnCall, OnDrop, void, size_t>;
+
+    auto context = ClosureType::into_context(on_call, on_drop);
+    ClosureType::call_from_context(context, 2);
+    detail::closures::IClosure<void, size_t>::call_from_context(context, 3);
+    assert(calls_count == 5);
+    ClosureType::delete_from_context(context);
+    assert(dropped);
+}
+
 int main(int argc, char** argv) {
     test_call_drop();
     test_context();
+    test_context_pool_reuse();
+    test_custom_context_allocator();
+    test_static_dispatch();
 }
\ No newline at end of file
@@ -0,0 +1,69 @@
+//
+// Copyright (c) 2024 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+#include "zenoh.hxx"
+using namespace zenoh;
+
+#undef NDEBUG
+#include <assert.h>
+
+void predefined() {
+    EncodingRegistry registry;
+    assert(registry.size() == EncodingRegistry::PREDEFINED_COUNT);
+    static_assert(EncodingRegistry::predefined_id("zenoh/bytes") == 0);
+    static_assert(EncodingRegistry::predefined_id("video/vp9") == EncodingRegistry::PREDEFINED_COUNT - 1);
+    static_assert(EncodingRegistry::predefined_id("foo/bar") == EncodingRegistry::UNKNOWN);
+
+    constexpr EncodingId json = EncodingRegistry::predefined_id("application/json");
+    assert(registry.find(Encoding("application/json")) == json);
+    assert(registry.find("application/json") == json);
+    assert(registry.intern("application/json") == json);
+    assert(registry.name(json) == "application/json");
+    assert(registry.get(json) == Encoding("application/json"));
+#if defined(ZENOHCXX_ZENOHC) || (Z_FEATURE_ENCODING_VALUES == 1)
+    assert(registry.find(Encoding::Predefined::text_plain()) == EncodingRegistry::predefined_id("text/plain"));
+#endif
+    for (EncodingId i = 0; i < EncodingRegistry::PREDEFINED_COUNT; i++) {
+        assert(registry.find(Encoding(EncodingRegistry::PREDEFINED[i])) == i);
+    }
+    assert(registry.size() == EncodingRegistry::PREDEFINED_COUNT);
+}
+
+void intern() {
+    EncodingRegistry registry;
+    assert(!registry.find("text/plain;utf-8").has_value());
+
+    Encoding utf8("text/plain");
+    utf8.set_schema("utf-8");
+    EncodingId id = registry.intern(utf8);
+    assert(id == EncodingRegistry::PREDEFINED_COUNT);
+    assert(registry.intern("text/plain;utf-8") == id);
+    assert(registry.find(utf8) == id);
+    assert(registry.get(id) == utf8);
+    assert(registry.name(id) == utf8.as_string());
+
+    EncodingId custom = registry.intern("my/encoding");
+    assert(custom == id + 1);
+    assert(registry.find(Encoding("my/encoding")) == custom);
+    assert(registry.size() == EncodingRegistry::PREDEFINED_COUNT + 2);
+
+    // references to interned encodings remain valid after registering more encodings
+    const Encoding& e = registry.get(custom);
+    for (size_t i = 0; i < 1000; i++) registry.intern("my/encoding;" + std::to_string(i));
+    assert(e == Encoding("my/encoding"));
+}
+
+int main(int argc, char** argv) {
+    predefined();
+    intern();
+}
@@ -0,0 +1,126 @@
+//
+// Copyright (c) 2024 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+#include <string_view>
+#include <vector>
+
+#include "zenoh.hxx"
+using namespace zenoh;
+
+#undef NDEBUG
+#include <assert.h>
+
+void invalid_format() {
+    for (auto f : {"", "a/${x:*", "a/${:*}", "a/${x:a//b}", "a${x:*}", "${x:*}b", "${x:*}${y:*}", "a//${x:*}"}) {
+        ZResult err = 0;
+        KeyExprFormat format(f, &err);
+        assert(err < 0);
+    }
+    ZResult err = -1;
+    KeyExprFormat format("${x:*}/${y:**}", &err);
+    assert(err == Z_OK);
+    assert(format.size() == 2);
+}
+
+void format() {
+    KeyExprFormat format("fleet/${robot:*}/sensor/${id:*}/imu");
+    assert(format.size() == 2);
+    assert(format.index("robot") == 0);
+    assert(format.index("id") == 1);
+    assert(!format.index("imu").has_value());
+
+    auto formatter = format.formatter();
+    ZResult err = 0;
+    assert(!formatter.view(&err).has_value());
+    assert(err < 0);  // placeholders are not set
+
+    formatter.set("robot", "r1").set("id", "7");
+    assert(formatter.view()->as_string_view() == "fleet/r1/sensor/7/imu");
+    KeyExpr k = formatter.build();
+    assert(k == "fleet/r1/sensor/7/imu");
+
+    formatter.set(1, "8");
+    assert(formatter.view()->as_string_view() == "fleet/r1/sensor/8/imu");
+    assert(k == "fleet/r1/sensor/7/imu");
+
+    // values must be included by placeholders patterns
+    formatter.set("id", "8/9", &err);
+    assert(err < 0);
+    formatter.set("id", "@8", &err);
+    assert(err < 0);
+    formatter.set("unknown", "8", &err);
+    assert(err < 0);
+    assert(formatter.view()->as_string_view() == "fleet/r1/sensor/8/imu");
+
+    formatter.set("robot", "*");
+    assert(formatter.view()->as_string_view() == "fleet/*/sensor/8/imu");
+}
+
+void format_non_canonical() {
+    KeyExprFormat format("a/${x:**}/*");
+    auto formatter = format.formatter();
+    formatter.set("x", "b/c");
+    assert(formatter.view()->as_string_view() == "a/b/c/*");
+
+    ZResult err = 0;
+    formatter.set("x", "**");
+    assert(!formatter.view(&err).has_value());
+    assert(err < 0);  // "a/**/*" is not canonical
+}
+
+void parse() {
+    KeyExprFormat format("fleet/${robot:*}/sensor/${id:*}/imu");
+    std::vector<std::string_view> values;
+
+    KeyExpr k("fleet/r1/sensor/7/imu");
+    assert(format.parse(k, values));
+    assert(values.size() == 2);
+    assert(values[0] == "r1");
+    assert(values[1] == "7");
+    assert(values[0].data() == k.as_string_view().data() + 6);
+
+    assert(!format.parse(KeyExpr("fleet/r1/sensor/7/gps"), values));
+    assert(!format.parse(KeyExpr("fleet/r1/sensor/7/8/imu"), values));
+    assert(!format.parse(KeyExpr("fleet/r1/sensor/imu"), values));
+
+    KeyExprFormat multi("${prefix:**}/sensor/${path:a/**}");
+    KeyExpr k1("x/y/sensor/a/b/c");
+    assert(multi.parse(k1, values));
+    assert(values[0] == "x/y");
+    assert(values[1] == "a/b/c");
+    KeyExpr k2("x/sensor/sensor/a");
+    assert(multi.parse(k2, values));
+    assert(values[0] == "x/sensor");
+    assert(values[1] == "a");
+    assert(!multi.parse(KeyExpr("x/sensor/b"), values));
+    assert(!multi.parse(KeyExpr("@x/sensor/a"), values));
+}
+
+void round_trip() {
+    KeyExprFormat format("${a:*}/x/${b:b$*}/${c:**}");
+    auto formatter = format.formatter();
+    formatter.set("a", "1").set("b", "bcd").set("c", "2/3/4");
+    std::vector<std::string_view> values;
+    assert(format.parse(*formatter.view(), values));
+    assert(values[0] == "1");
+    assert(values[1] == "bcd");
+    assert(values[2] == "2/3/4");
+}
+
+int main(int argc, char** argv) {
+    invalid_format();
+    format();
+    format_non_canonical();
+    parse();
+    round_trip();
+}
@@ -0,0 +1,170 @@
+//
+// Copyright (c) 2024 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "zenoh.hxx"
+using namespace zenoh;
+
+#undef NDEBUG
+#include <assert.h>
+
+const std::vector<std::string> KEYS = {
+    "a", "a/b", "a/b/c", "a/c", "a/b/c/d", "b/c", "a/*", "a/**", "*/b", "**/c", "a/*/c", "a/**/c", "*/**", "**",
+    "a/b$*", "a/$*c", "a/bc", "a/b$*/c", "@a/b", "@a/**", "a/@b", "a/@b/c", "a/*/**", "*/*/c", "a/b/**", "**/b/**", "b",
+    "a/b$*c", "a/bxc",
+};
+
+std::vector<std::string> collect(const KeyExprTree<int>& tree, KeyExprTreeQuery kind, const KeyExpr& ke) {
+    std::vector<std::string> out;
+    tree.query(kind, ke, [&out](std::string_view k, const int&) { out.emplace_back(k); });
+    std::sort(out.begin(), out.end());
+    return out;
+}
+
+void insert_get_erase() {
+    KeyExprTree<int> tree;
+    assert(tree.empty());
+    assert(tree.insert(KeyExpr("a/b/c"), 1));
+    assert(tree.insert(KeyExpr("a/b"), 2));
+    assert(!tree.insert(KeyExpr("a/b/c"), 3));
+    assert(tree.size() == 2);
+
+    assert(*tree.get(KeyExpr("a/b/c")) == 3);
+    assert(*tree.get(KeyExpr("a/b")) == 2);
+    assert(tree.get(KeyExpr("a")) == nullptr);
+    assert(tree.get(KeyExpr("a/b/c/d")) == nullptr);
+
+    assert(!tree.erase(KeyExpr("a")));
+    assert(tree.erase(KeyExpr("a/b/c")));
+    assert(!tree.erase(KeyExpr("a/b/c")));
+    assert(tree.get(KeyExpr("a/b/c")) == nullptr);
+    assert(*tree.get(KeyExpr("a/b")) == 2);
+    assert(tree.size() == 1);
+
+    tree.clear();
+    assert(tree.empty());
+    assert(tree.get(KeyExpr("a/b")) == nullptr);
+}
+
+void move_then_erase() {
+    KeyExprTree<int> tree;
+    tree.insert(KeyExpr("a/b/c"), 1);
+    tree.insert(KeyExpr("a/*"), 2);
+
+    KeyExprTree<int> moved(std::move(tree));
+    assert(tree.empty());
+    assert(moved.size() == 2);
+    assert(moved.erase(KeyExpr("a/b/c")));
+    assert(moved.erase(KeyExpr("a/*")));
+    assert(moved.empty());
+    assert(collect(moved, KeyExprTreeQuery::INTERSECTING, KeyExpr("**")).empty());
+
+    moved.insert(KeyExpr("x/y"), 3);
+    tree.insert(KeyExpr("z"), 4);
+    tree = std::move(moved);
+    assert(moved.empty());
+    assert(tree.size() == 1);
+    assert(tree.erase(KeyExpr("x/y")));
+    assert(tree.empty());
+    moved.insert(KeyExpr("x/y"), 5);
+    assert(*moved.get(KeyExpr("x/y")) == 5);
+}
+
+void wildcards() {
+    KeyExprTree<int> tree;
+    for (auto k : {"a/b/c", "a/b/d", "a/x/c", "a/**", "a/*/c", "a/b$*", "@a/b"}) tree.insert(KeyExpr(k), 0);
+
+    using V = std::vector<std::string>;
+    assert(collect(tree, KeyExprTreeQuery::INTERSECTING, KeyExpr("a/b/c")) == (V{"a/**", "a/*/c", "a/b/c"}));
+    assert(collect(tree, KeyExprTreeQuery::INTERSECTING, KeyExpr("a/*/c")) == (V{"a/**", "a/*/c", "a/b/c", "a/x/c"}));
+    assert(collect(tree, KeyExprTreeQuery::INTERSECTING, KeyExpr("a/bz")) == (V{"a/**", "a/b$*"}));
+    assert(collect(tree, KeyExprTreeQuery::INTERSECTING, KeyExpr("**")) ==
+           (V{"a/**", "a/*/c", "a/b$*", "a/b/c", "a/b/d", "a/x/c"}));
+    assert(collect(tree, KeyExprTreeQuery::INTERSECTING, KeyExpr("*/b")) == (V{"a/**", "a/b$*"}));
+    assert(collect(tree, KeyExprTreeQuery::INTERSECTING, KeyExpr("@a/b")) == (V{"@a/b"}));
+
+    assert(collect(tree, KeyExprTreeQuery::INCLUDED_BY, KeyExpr("a/*/c")) == (V{"a/*/c", "a/b/c", "a/x/c"}));
+    assert(collect(tree, KeyExprTreeQuery::INCLUDED_BY, KeyExpr("a/b/**")) == (V{"a/b/c", "a/b/d"}));
+
+    assert(collect(tree, KeyExprTreeQuery::INCLUDING, KeyExpr("a/b/c")) == (V{"a/**", "a/*/c", "a/b/c"}));
+    assert(collect(tree, KeyExprTreeQuery::INCLUDING, KeyExpr("a/bz")) == (V{"a/**", "a/b$*"}));
+
+    // chunks too long for the `$*` matching table to fit on the stack
+    const std::string long_chunk = "a/b" + std::string(100, 'z');
+    assert(collect(tree, KeyExprTreeQuery::INTERSECTING, KeyExpr(long_chunk)) == (V{"a/**", "a/b$*"}));
+    assert(collect(tree, KeyExprTreeQuery::INCLUDING, KeyExpr(long_chunk)) == (V{"a/**", "a/b$*"}));
+    assert(collect(tree, KeyExprTreeQuery::INTERSECTING, KeyExpr("a/" + std::string(100, 'z') + "$*")) ==
+           (V{"a/**"}));
+}
+
+void consistent_with_keyexpr() {
+    KeyExprTree<int> tree;
+    for (const auto& k : KEYS) tree.insert(KeyExpr(k), 0);
+
+    for (const auto& q : KEYS) {
+        KeyExpr query(q);
+        std::vector<std::string> intersecting, included_by, including;
+        for (const auto& k : KEYS) {
+            KeyExpr stored(k);
+            if (query.intersects(stored)) intersecting.push_back(k);
+            if (query.includes(stored)) included_by.push_back(k);
+            if (stored.includes(query)) including.push_back(k);
+        }
+        std::sort(intersecting.begin(), intersecting.end());
+        std::sort(included_by.begin(), included_by.end());
+        std::sort(including.begin(), including.end());
+        assert(collect(tree, KeyExprTreeQuery::INTERSECTING, query) == intersecting);
+        assert(collect(tree, KeyExprTreeQuery::INCLUDED_BY, query) == included_by);
+        assert(collect(tree, KeyExprTreeQuery::INCLUDING, query) == including);
+    }
+}
+
+void matcher() {
+    KeyExprMatcher matcher;
+    for (size_t i = 0; i < KEYS.size(); i++) assert(matcher.add(KeyExpr(KEYS[i])) == i);
+    assert(matcher.add(KeyExpr(KEYS[3])) == 3);
+    assert(matcher.size() == KEYS.size());
+
+    std::vector<size_t> matches;
+    for (const auto& q : KEYS) {
+        KeyExpr query(q);
+        for (auto kind : {KeyExprTreeQuery::INTERSECTING, KeyExprTreeQuery::INCLUDED_BY, KeyExprTreeQuery::INCLUDING}) {
+            std::vector<std::string> expected;
+            for (const auto& k : KEYS) {
+                KeyExpr stored(k);
+                if ((kind == KeyExprTreeQuery::INTERSECTING && query.intersects(stored)) ||
+                    (kind == KeyExprTreeQuery::INCLUDED_BY && query.includes(stored)) ||
+                    (kind == KeyExprTreeQuery::INCLUDING && stored.includes(query))) {
+                    expected.push_back(k);
+                }
+            }
+            std::sort(expected.begin(), expected.end());
+            matcher.match(query, matches, kind);
+            std::vector<std::string> found;
+            for (size_t i : matches) found.push_back(KEYS[i]);
+            std::sort(found.begin(), found.end());
+            assert(found == expected);
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    insert_get_erase();
+    move_then_erase();
+    wildcards();
+    consistent_with_keyexpr();
+    matcher();
+}
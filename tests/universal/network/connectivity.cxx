@@ -91,6 +91,8 @@ void test_info_zid() {
         auto s1_zid = s1.get_zid();
         auto s2_zid = s2.get_zid();
         assert(!(s1_zid == s2_zid));
+        assert(std::hash<Id>()(s1_zid) == std::hash<Id>()(s1.get_zid()));
+        assert(std::hash<Id>()(s1_zid) != std::hash<Id>()(s2_zid));
 
         assert(s1.get_routers_z_id().empty());
         auto peers_of_s1 = s1.get_peers_z_id();
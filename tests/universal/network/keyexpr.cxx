@@ -11,8 +11,15 @@
 // Contributors:
 //   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
 //
+#include <chrono>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
 #include "zenoh.hxx"
 using namespace zenoh;
+using namespace std::chrono_literals;
 
 #undef NDEBUG
 #include <assert.h>
@@ -89,6 +96,82 @@ void intersects() {
     assert(starbuz.intersects(foobuz));
 }
 
+void literal() {
+    static_assert(detail::keyexpr_canon_error("a/b/c") == nullptr);
+    static_assert(detail::keyexpr_canon_error("a/*/b$*/**/@c") == nullptr);
+    static_assert(detail::keyexpr_canon_error("") != nullptr);
+    static_assert(detail::keyexpr_canon_error("a//b") != nullptr);
+    static_assert(detail::keyexpr_canon_error("a/b/") != nullptr);
+    static_assert(detail::keyexpr_canon_error("a/**/**") != nullptr);
+    static_assert(detail::keyexpr_canon_error("a/**/*") != nullptr);
+    static_assert(detail::keyexpr_canon_error("a/$*") != nullptr);
+    static_assert(detail::keyexpr_canon_error("a/b*") != nullptr);
+    static_assert(detail::keyexpr_canon_error("a/$*$*b") != nullptr);
+    static_assert(detail::keyexpr_canon_error("a/b$") != nullptr);
+    static_assert(detail::keyexpr_canon_error("@a$*") != nullptr);
+    static_assert(detail::keyexpr_canon_error("a?b") != nullptr);
+
+    constexpr auto foobar = "FOO/*/BAR"_ke;
+    static_assert(foobar.as_string_view() == "FOO/*/BAR");
+    assert(KeyExpr::is_canon(foobar.as_string_view()));
+
+    KeyExprView view(foobar);
+    const KeyExpr& k = view;
+    assert(view.as_string_view() == "FOO/*/BAR");
+    assert(k == KeyExpr("FOO/*/BAR"));
+    assert(k.intersects(KeyExpr("FOO/BUZ/BAR")));
+
+    ZResult err = 0;
+    try {
+        KeyExprLiteral(std::string_view("FOO/**/**"));
+    } catch (const ZException& e) {
+        err = e.e;
+    }
+    assert(err < 0);
+}
+
+void view() {
+    std::string foobar = "FOO/BAR";
+    KeyExprView v1(foobar);
+    assert(v1.as_string_view().data() == foobar.data());
+    assert(static_cast<const KeyExpr&>(v1) == KeyExpr("FOO/BAR"));
+
+    KeyExpr k("FOO/*");
+    KeyExprView v2(k);
+    assert(v2.as_string_view().data() == k.as_string_view().data());
+    assert(k.intersects(v1));
+
+#ifdef ZENOHCXX_ZENOHC  // Pico does not validate key expressions yet.
+    // non-canonical key expressions are autocanonized, like in KeyExpr constructor
+    KeyExprView v3("FOO/**/**");
+    assert(v3.as_string_view() == "FOO/**");
+
+    ZResult err = 0;
+    KeyExprView v4("FOO//BAR", &err);
+    assert(err < 0);
+#endif
+}
+
+void hash() {
+    std::unordered_map<KeyExpr, int> map;
+    map.emplace(KeyExpr("FOO/BAR"), 1);
+    map.emplace(KeyExpr("FOO/*"), 2);
+    assert(map.at(KeyExpr("FOO/BAR")) == 1);
+    assert(map.at(KeyExpr("FOO/*")) == 2);
+    assert(map.find(KeyExpr("FOO/BUZ")) == map.end());
+
+    HashedKeyExpr foobar(KeyExpr("FOO/BAR"));
+    assert(foobar.hash() == std::hash<KeyExpr>()(KeyExpr("FOO/BAR")));
+    assert(foobar == HashedKeyExpr(KeyExpr("FOO/BAR")));
+    assert(foobar != HashedKeyExpr(KeyExpr("FOO/BUZ")));
+    assert(foobar.get_keyexpr() == "FOO/BAR");
+    assert(map.at(foobar) == 1);
+
+    std::unordered_map<HashedKeyExpr, int> hashed_map;
+    hashed_map.emplace(foobar, 1);
+    assert(hashed_map.at(foobar) == 1);
+}
+
 void declare(Session& s) {
     KeyExpr foobar("FOO/BAR");
     KeyExpr foostar("FOO/*");
@@ -101,6 +184,62 @@ void declare(Session& s) {
     assert(declared.intersects(foobar));
     s.undeclare_keyexpr(std::move(declared));
     assert(!interop::detail::check(declared));
+
+    std::string foobuz = "FOO/BUZ";
+    auto declared_from_view = s.declare_keyexpr(foobuz);
+    assert(declared_from_view.as_string_view() == "FOO/BUZ");
+    s.undeclare_keyexpr(std::move(declared_from_view));
+}
+
+void declaration_cache(Session& s) {
+    KeyExprCache::KeyExprCacheOptions options;
+    options.capacity = 2;
+    options.declare_threshold = 3;
+    options.max_tracked = 4;
+    KeyExprCache cache(s, std::move(options));
+
+    for (size_t i = 0; i < 2; i++) assert(cache.resolve("FOO/BAR").as_string_view() == "FOO/BAR");
+    auto stats = cache.get_stats();
+    assert(stats.hits == 0 && stats.misses == 2 && stats.declared == 0 && stats.tracked == 1);
+
+    // the third use declares the key expression, next ones are hits
+    for (size_t i = 0; i < 3; i++) assert(cache.resolve("FOO/BAR").as_string_view() == "FOO/BAR");
+    stats = cache.get_stats();
+    assert(stats.hits == 2 && stats.misses == 3 && stats.declarations == 1 && stats.declared == 1);
+
+    for (size_t i = 0; i < 3; i++) cache.resolve("FOO/BUZ");
+    for (size_t i = 0; i < 3; i++) cache.resolve("FOO/QUX");
+    stats = cache.get_stats();
+    assert(stats.declarations == 3 && stats.evictions == 1 && stats.declared == 2);
+    // FOO/BAR was the least recently used declaration
+    cache.resolve("FOO/BAR");
+    assert(cache.get_stats().hits == 2);
+
+    // counters of the least recently used undeclared key expressions are dropped when too many key expressions are
+    // tracked, declared ones are kept
+    for (auto k : {"A", "B", "C", "D", "E"}) cache.resolve(k);
+    stats = cache.get_stats();
+    assert(stats.tracked == 4 && stats.declared == 2);
+
+    cache.put("FOO/QUX", Bytes("data"));
+    assert(cache.get_stats().hits == 3);
+
+    cache.clear();
+    stats = cache.get_stats();
+    assert(stats.declared == 0 && stats.tracked == 0);
+}
+
+void hashed_session(Session& s) {
+    HashedKeyExpr key(KeyExpr("FOO/HASHED"));
+    std::vector<std::string> received;
+    auto subscriber = s.declare_subscriber(
+        key, [&received](const Sample& sample) { received.emplace_back(sample.get_keyexpr().as_string_view()); },
+        closures::none);
+    std::this_thread::sleep_for(1s);
+    s.put(key, Bytes("data"));
+    std::this_thread::sleep_for(1s);
+    std::move(subscriber).undeclare();
+    assert(received.size() == 1 && received[0] == "FOO/HASHED");
 }
 
 int main(int argc, char** argv) {
@@ -111,9 +250,14 @@ int main(int argc, char** argv) {
     equals();
     includes();
     intersects();
+    literal();
+    view();
+    hash();
 
     // Session based tests
     Config config = Config::create_default();
     auto session = Session::open(std::move(config));
     declare(session);
+    declaration_cache(session);
+    hashed_session(session);
 }
@@ -13,7 +13,16 @@
 //
 
 #include <chrono>
+#include <mutex>
+#include <set>
+#include <string>
 #include <thread>
+#include <tuple>
+#include <vector>
+
+#if defined(__linux__)
+#include <poll.h>
+#endif
 
 #include "zenoh.hxx"
 
@@ -198,6 +207,395 @@ void put_sub_ring_channel(Talloc& alloc) {
     }
 }
 
+template <typename Talloc>
+void put_sub_channel_batch(Talloc& alloc) {
+    KeyExpr ke("zenoh/test");
+    auto session1 = Session::open(Config::create_default());
+    auto session2 = Session::open(Config::create_default());
+
+    std::this_thread::sleep_for(1s);
+
+    auto fifo_subscriber = session2.declare_subscriber(ke, channels::FifoChannel(16));
+    auto ring_subscriber = session2.declare_subscriber(ke, channels::RingChannel(2));
+
+    std::this_thread::sleep_for(1s);
+
+    session1.put(ke, alloc.alloc_with_data("first"));
+    session1.put(ke, alloc.alloc_with_data("second"));
+    session1.put(ke, alloc.alloc_with_data("third"));
+
+    std::this_thread::sleep_for(1s);
+
+    std::vector<Sample> samples;
+    auto res = fifo_subscriber.handler().recv_batch(samples, 2);
+    assert(std::holds_alternative<size_t>(res));
+    assert(std::get<size_t>(res) == 2);
+    res = fifo_subscriber.handler().try_recv_all(samples);
+    assert(std::holds_alternative<size_t>(res));
+    assert(std::get<size_t>(res) == 1);
+    assert(samples.size() == 3);
+    assert(samples[0].get_payload().as_string() == "first");
+    assert(samples[1].get_payload().as_string() == "second");
+    assert(samples[2].get_payload().as_string() == "third");
+    res = fifo_subscriber.handler().try_recv_batch(samples, 16);
+    assert(std::holds_alternative<channels::RecvError>(res));
+    assert(std::get<channels::RecvError>(res) == channels::RecvError::Z_NODATA);
+
+    samples.clear();
+    res = ring_subscriber.handler().try_recv_batch(samples, 16);
+    assert(std::holds_alternative<size_t>(res));
+    assert(std::get<size_t>(res) == 2);
+    assert(samples[0].get_payload().as_string() == "second");
+    assert(samples[1].get_payload().as_string() == "third");
+
+    session2.close();
+    res = fifo_subscriber.handler().recv_batch(samples, 16);
+    assert(std::holds_alternative<channels::RecvError>(res));
+    assert(std::get<channels::RecvError>(res) == channels::RecvError::Z_DISCONNECTED);
+    z_result_t err;
+    std::move(fifo_subscriber).undeclare(&err);
+    std::move(ring_subscriber).undeclare(&err);
+}
+
+template <typename Talloc>
+void put_sub_channel_timed_recv(Talloc& alloc) {
+    KeyExpr ke("zenoh/test");
+    auto session1 = Session::open(Config::create_default());
+    auto session2 = Session::open(Config::create_default());
+
+    std::this_thread::sleep_for(1s);
+
+    auto fifo_subscriber = session2.declare_subscriber(ke, channels::NotifyingFifoChannel(16));
+    auto ring_subscriber = session2.declare_subscriber(ke, channels::NotifyingRingChannel(16));
+
+    std::this_thread::sleep_for(1s);
+
+    auto start = std::chrono::steady_clock::now();
+    auto res = fifo_subscriber.handler().recv_for(100ms);
+    assert(std::chrono::steady_clock::now() - start >= 100ms);
+    assert(std::holds_alternative<channels::RecvError>(res));
+    assert(std::get<channels::RecvError>(res) == channels::RecvError::Z_NODATA);
+
+    std::thread publisher_thread([&session1, &ke, &alloc]() {
+        std::this_thread::sleep_for(200ms);
+        session1.put(ke, alloc.alloc_with_data("first"));
+    });
+    res = fifo_subscriber.handler().recv_for(10s);
+    assert(std::holds_alternative<Sample>(res));
+    assert(std::get<Sample>(res).get_payload().as_string() == "first");
+    res = ring_subscriber.handler().recv_until(std::chrono::steady_clock::now() + 10s);
+    assert(std::holds_alternative<Sample>(res));
+    assert(std::get<Sample>(res).get_payload().as_string() == "first");
+    publisher_thread.join();
+
+    session2.close();
+    res = fifo_subscriber.handler().recv_for(10s);
+    assert(std::holds_alternative<channels::RecvError>(res));
+    assert(std::get<channels::RecvError>(res) == channels::RecvError::Z_DISCONNECTED);
+    z_result_t err;
+    auto fifo_handler = std::move(fifo_subscriber).undeclare(&err);
+    std::move(ring_subscriber).undeclare(&err);
+
+    auto moved_handler = std::move(fifo_handler);
+    res = fifo_handler.recv_for(10ms);
+    assert(std::holds_alternative<channels::RecvError>(res));
+    assert(std::get<channels::RecvError>(res) == channels::RecvError::Z_DISCONNECTED);
+}
+
+template <typename Talloc>
+void put_sub_channel_stats(Talloc& alloc) {
+    KeyExpr ke("zenoh/test");
+    auto session1 = Session::open(Config::create_default());
+    auto session2 = Session::open(Config::create_default());
+
+    std::this_thread::sleep_for(1s);
+
+    auto fifo_subscriber = session2.declare_subscriber(ke, channels::NotifyingFifoChannel(16, true));
+    auto ring_subscriber = session2.declare_subscriber(ke, channels::NotifyingRingChannel(2, true));
+    auto plain_subscriber = session2.declare_subscriber(ke, channels::NotifyingFifoChannel(16));
+    assert(!plain_subscriber.handler().get_stats().has_value());
+
+    std::this_thread::sleep_for(1s);
+
+    session1.put(ke, alloc.alloc_with_data("first"));
+    session1.put(ke, alloc.alloc_with_data("second"));
+    session1.put(ke, alloc.alloc_with_data("third"));
+
+    std::this_thread::sleep_for(1s);
+
+    auto stats = fifo_subscriber.handler().get_stats().value();
+    assert(stats.capacity == 16);
+    assert(stats.enqueued == 3);
+    assert(stats.dequeued == 0);
+    assert(stats.depth == 3);
+    assert(stats.high_water_mark == 3);
+    assert(stats.dropped == 0);
+    assert(stats.blocked == 0);
+
+    auto res = fifo_subscriber.handler().recv();
+    assert(std::holds_alternative<Sample>(res));
+    stats = fifo_subscriber.handler().get_stats().value();
+    assert(stats.dequeued == 1);
+    assert(stats.depth == 2);
+    uint64_t sampled = 0;
+    for (auto count : stats.queue_time_histogram) sampled += count;
+    assert(sampled == 1);
+    std::vector<Sample> samples;
+    fifo_subscriber.handler().try_recv_all(samples);
+    stats = fifo_subscriber.handler().get_stats().value();
+    assert(stats.dequeued == 3);
+    assert(stats.depth == 0);
+    assert(stats.high_water_mark == 3);
+
+    stats = ring_subscriber.handler().get_stats().value();
+    assert(stats.enqueued == 3);
+    assert(stats.dropped == 1);
+    assert(stats.depth == 2);
+    assert(stats.high_water_mark == 2);
+    res = ring_subscriber.handler().try_recv();
+    assert(std::holds_alternative<Sample>(res));
+    assert(std::get<Sample>(res).get_payload().as_string() == "second");
+    stats = ring_subscriber.handler().get_stats().value();
+    assert(stats.dequeued == 1);
+    assert(stats.depth == 1);
+}
+
+#if defined(__linux__)
+bool is_readable(int fd, int timeout_ms) {
+    pollfd pfd = {fd, POLLIN, 0};
+    return ::poll(&pfd, 1, timeout_ms) == 1 && (pfd.revents & POLLIN) != 0;
+}
+
+template <typename Talloc>
+void put_sub_channel_fd(Talloc& alloc) {
+    KeyExpr ke("zenoh/test");
+    auto session1 = Session::open(Config::create_default());
+    auto session2 = Session::open(Config::create_default());
+
+    std::this_thread::sleep_for(1s);
+
+    auto fifo_subscriber = session2.declare_subscriber(ke, channels::NotifyingFifoChannel(16));
+    auto ring_subscriber = session2.declare_subscriber(ke, channels::NotifyingRingChannel(16));
+    int fifo_fd = fifo_subscriber.handler().get_fd();
+    int ring_fd = ring_subscriber.handler().get_fd();
+    assert(fifo_fd >= 0 && ring_fd >= 0 && fifo_fd != ring_fd);
+    assert(fifo_subscriber.handler().get_fd() == fifo_fd);
+    assert(is_readable(fifo_fd, 0));
+    fifo_subscriber.handler().reset_fd();
+    ring_subscriber.handler().reset_fd();
+    assert(!is_readable(fifo_fd, 0));
+    assert(!is_readable(ring_fd, 0));
+
+    std::this_thread::sleep_for(1s);
+
+    session1.put(ke, alloc.alloc_with_data("first"));
+    session1.put(ke, alloc.alloc_with_data("second"));
+    assert(is_readable(fifo_fd, 10000));
+    assert(is_readable(ring_fd, 10000));
+
+    std::this_thread::sleep_for(1s);
+
+    fifo_subscriber.handler().reset_fd();
+    assert(!is_readable(fifo_fd, 0));
+    std::vector<Sample> samples;
+    auto res = fifo_subscriber.handler().try_recv_all(samples);
+    assert(std::holds_alternative<size_t>(res));
+    assert(std::get<size_t>(res) == 2);
+    assert(!is_readable(fifo_fd, 0));
+
+    session1.put(ke, alloc.alloc_with_data("third"));
+    assert(is_readable(fifo_fd, 10000));
+    fifo_subscriber.handler().reset_fd();
+    auto sample_res = fifo_subscriber.handler().try_recv();
+    assert(std::holds_alternative<Sample>(sample_res));
+    assert(std::get<Sample>(sample_res).get_payload().as_string() == "third");
+
+    /// closing the channel should also make descriptor readable
+    session2.close();
+    assert(is_readable(fifo_fd, 10000));
+    fifo_subscriber.handler().reset_fd();
+    sample_res = fifo_subscriber.handler().try_recv();
+    assert(std::holds_alternative<channels::RecvError>(sample_res));
+    assert(std::get<channels::RecvError>(sample_res) == channels::RecvError::Z_DISCONNECTED);
+    z_result_t err;
+    std::move(fifo_subscriber).undeclare(&err);
+    std::move(ring_subscriber).undeclare(&err);
+}
+#endif
+
+template <typename Talloc>
+void put_sub_lockfree_channel(Talloc& alloc) {
+    KeyExpr ke("zenoh/test");
+    auto session1 = Session::open(Config::create_default());
+    auto session2 = Session::open(Config::create_default());
+
+    std::this_thread::sleep_for(1s);
+
+    auto spsc_subscriber = session2.declare_subscriber(ke, channels::SpscChannel<channels::SpinWait>(3));
+    auto mpsc_subscriber = session2.declare_subscriber(ke, channels::MpscChannel(16));
+    assert(spsc_subscriber.handler().capacity() == 4);
+    assert(mpsc_subscriber.handler().capacity() == 16);
+
+    std::this_thread::sleep_for(1s);
+
+    session1.put(ke, alloc.alloc_with_data("first"));
+    session1.put(ke, alloc.alloc_with_data("second"));
+
+    std::this_thread::sleep_for(1s);
+
+    auto res = spsc_subscriber.handler().recv();
+    assert(std::holds_alternative<Sample>(res));
+    assert(std::get<Sample>(res).get_keyexpr() == "zenoh/test");
+    assert(std::get<Sample>(res).get_payload().as_string() == "first");
+    res = spsc_subscriber.handler().try_recv();
+    assert(std::holds_alternative<Sample>(res));
+    assert(std::get<Sample>(res).get_payload().as_string() == "second");
+    res = spsc_subscriber.handler().try_recv();
+    assert(std::holds_alternative<channels::RecvError>(res));
+    assert(std::get<channels::RecvError>(res) == channels::RecvError::Z_NODATA);
+
+    std::vector<Sample> samples;
+    auto batch_res = mpsc_subscriber.handler().recv_batch(samples, 16);
+    assert(std::holds_alternative<size_t>(batch_res));
+    assert(std::get<size_t>(batch_res) == 2);
+    assert(samples[0].get_payload().as_string() == "first");
+    assert(samples[1].get_payload().as_string() == "second");
+    res = mpsc_subscriber.handler().recv_for(100ms);
+    assert(std::holds_alternative<channels::RecvError>(res));
+    assert(std::get<channels::RecvError>(res) == channels::RecvError::Z_NODATA);
+
+    std::thread t([&]() {
+        std::this_thread::sleep_for(200ms);
+        session1.put(ke, alloc.alloc_with_data("third"));
+    });
+    res = mpsc_subscriber.handler().recv();
+    t.join();
+    assert(std::holds_alternative<Sample>(res));
+    assert(std::get<Sample>(res).get_payload().as_string() == "third");
+
+    /// after session close subscriber handler should become disconnected
+    session2.close();
+    res = spsc_subscriber.handler().recv();
+    assert(std::holds_alternative<Sample>(res));
+    assert(std::get<Sample>(res).get_payload().as_string() == "third");
+    res = spsc_subscriber.handler().recv();
+    assert(std::holds_alternative<channels::RecvError>(res));
+    assert(std::get<channels::RecvError>(res) == channels::RecvError::Z_DISCONNECTED);
+    res = mpsc_subscriber.handler().recv();
+    assert(std::holds_alternative<channels::RecvError>(res));
+    assert(std::get<channels::RecvError>(res) == channels::RecvError::Z_DISCONNECTED);
+    z_result_t err;
+    auto spsc_handler = std::move(spsc_subscriber).undeclare(&err);
+    std::move(mpsc_subscriber).undeclare(&err);
+
+    auto moved_handler = std::move(spsc_handler);
+    assert(spsc_handler.capacity() == 0);
+    res = spsc_handler.try_recv();
+    assert(std::holds_alternative<channels::RecvError>(res));
+    assert(std::get<channels::RecvError>(res) == channels::RecvError::Z_DISCONNECTED);
+    res = spsc_handler.recv_for(10ms);
+    assert(std::holds_alternative<channels::RecvError>(res));
+    assert(std::get<channels::RecvError>(res) == channels::RecvError::Z_DISCONNECTED);
+}
+
+template <typename Talloc>
+void put_sub_conflating_channel(Talloc& alloc) {
+    auto session1 = Session::open(Config::create_default());
+    auto session2 = Session::open(Config::create_default());
+
+    std::this_thread::sleep_for(1s);
+
+    auto subscriber = session2.declare_subscriber(KeyExpr("zenoh/test/*"), channels::ConflatingChannel());
+
+    std::this_thread::sleep_for(1s);
+
+    session1.put(KeyExpr("zenoh/test/a"), alloc.alloc_with_data("a1"));
+    session1.put(KeyExpr("zenoh/test/b"), alloc.alloc_with_data("b1"));
+    session1.put(KeyExpr("zenoh/test/a"), alloc.alloc_with_data("a2"));
+    session1.put(KeyExpr("zenoh/test/a"), alloc.alloc_with_data("a3"));
+
+    std::this_thread::sleep_for(1s);
+
+    assert(subscriber.handler().size() == 2);
+    assert(subscriber.handler().overwritten_count() == 2);
+    std::vector<Sample> samples;
+    auto res = subscriber.handler().try_recv_all(samples);
+    assert(std::holds_alternative<size_t>(res));
+    assert(std::get<size_t>(res) == 2);
+    assert(samples[0].get_keyexpr() == "zenoh/test/a");
+    assert(samples[0].get_payload().as_string() == "a3");
+    assert(samples[1].get_keyexpr() == "zenoh/test/b");
+    assert(samples[1].get_payload().as_string() == "b1");
+    auto sample_res = subscriber.handler().recv_for(100ms);
+    assert(std::holds_alternative<channels::RecvError>(sample_res));
+    assert(std::get<channels::RecvError>(sample_res) == channels::RecvError::Z_NODATA);
+
+    session1.put(KeyExpr("zenoh/test/b"), alloc.alloc_with_data("b2"));
+    sample_res = subscriber.handler().recv();
+    assert(std::holds_alternative<Sample>(sample_res));
+    assert(std::get<Sample>(sample_res).get_payload().as_string() == "b2");
+
+    session2.close();
+    sample_res = subscriber.handler().recv();
+    assert(std::holds_alternative<channels::RecvError>(sample_res));
+    assert(std::get<channels::RecvError>(sample_res) == channels::RecvError::Z_DISCONNECTED);
+    z_result_t err;
+    std::move(subscriber).undeclare(&err);
+}
+
+template <typename Talloc>
+void put_sub_dispatcher(Talloc& alloc) {
+    auto session1 = Session::open(Config::create_default());
+    auto session2 = Session::open(Config::create_default());
+
+    std::this_thread::sleep_for(1s);
+
+    std::mutex m;
+    std::vector<std::string> a_values, b_values;
+    std::set<std::thread::id> threads;
+    bool dropped = false;
+    Dispatcher::DispatcherOptions opts;
+    opts.num_workers = 4;
+    opts.queue_capacity = 2;
+    Dispatcher dispatcher(std::move(opts));
+    assert(dispatcher.get_num_workers() == 4);
+    auto on_sample = [&](Sample& s) {
+        std::this_thread::sleep_for(10ms);
+        std::lock_guard<std::mutex> lock(m);
+        threads.insert(std::this_thread::get_id());
+        auto& values = s.get_keyexpr() == "zenoh/test/a" ? a_values : b_values;
+        values.push_back(s.get_payload().as_string());
+    };
+    auto on_drop = [&]() {
+        std::lock_guard<std::mutex> lock(m);
+        dropped = true;
+    };
+    auto subscriber = session2.declare_subscriber(KeyExpr("zenoh/test/*"), dispatcher.wrap(on_sample, on_drop),
+                                                  closures::none);
+
+    std::this_thread::sleep_for(1s);
+
+    for (size_t i = 0; i < 10; i++) {
+        session1.put(KeyExpr("zenoh/test/a"), alloc.alloc_with_data(std::to_string(i).c_str()));
+        session1.put(KeyExpr("zenoh/test/b"), alloc.alloc_with_data(std::to_string(i).c_str()));
+    }
+
+    std::this_thread::sleep_for(1s);
+
+    std::move(subscriber).undeclare();
+    std::this_thread::sleep_for(1s);
+    std::lock_guard<std::mutex> lock(m);
+    assert(dropped);
+    assert(a_values.size() == 10);
+    assert(b_values.size() == 10);
+    for (size_t i = 0; i < 10; i++) {
+        assert(a_values[i] == std::to_string(i));
+        assert(b_values[i] == std::to_string(i));
+    }
+    assert(threads.count(std::this_thread::get_id()) == 0);
+    assert(dispatcher.get_dropped_count() == 0);
+}
+
 template <typename Talloc, bool share_alloc = true>
 void test_with_alloc() {
     if constexpr (share_alloc) {
@@ -206,6 +604,15 @@ void test_with_alloc() {
         put_sub(alloc);
         put_sub_fifo_channel(alloc);
         put_sub_ring_channel(alloc);
+        put_sub_channel_batch(alloc);
+        put_sub_channel_timed_recv(alloc);
+        put_sub_channel_stats(alloc);
+#if defined(__linux__)
+        put_sub_channel_fd(alloc);
+#endif
+        put_sub_lockfree_channel(alloc);
+        put_sub_conflating_channel(alloc);
+        put_sub_dispatcher(alloc);
     } else {
         {
             Talloc alloc;
@@ -223,6 +630,36 @@ void test_with_alloc() {
             Talloc alloc;
             put_sub_ring_channel(alloc);
         }
+        {
+            Talloc alloc;
+            put_sub_channel_batch(alloc);
+        }
+        {
+            Talloc alloc;
+            put_sub_channel_timed_recv(alloc);
+        }
+        {
+            Talloc alloc;
+            put_sub_channel_stats(alloc);
+        }
+#if defined(__linux__)
+        {
+            Talloc alloc;
+            put_sub_channel_fd(alloc);
+        }
+#endif
+        {
+            Talloc alloc;
+            put_sub_lockfree_channel(alloc);
+        }
+        {
+            Talloc alloc;
+            put_sub_conflating_channel(alloc);
+        }
+        {
+            Talloc alloc;
+            put_sub_dispatcher(alloc);
+        }
     }
 }
 
@@ -233,6 +670,47 @@ void publisher_get_keyexpr() {
     assert(publisher.get_keyexpr().as_string_view() == "zenoh/test_publisher_keyexpr");
 }
 
+void attaching_publisher() {
+    KeyExpr ke("zenoh/test_attaching_publisher");
+    auto session1 = Session::open(Config::create_default());
+    auto session2 = Session::open(Config::create_default());
+
+    Session::PublisherOptions options;
+    options.encoding = Encoding("text/plain");
+    AttachingPublisher publisher(session1.declare_publisher(ke, std::move(options)), Bytes("header"));
+    assert(publisher.get_attachment()->as_string() == "header");
+    assert(publisher.get_publisher().get_keyexpr().as_string_view() == "zenoh/test_attaching_publisher");
+
+    std::vector<std::tuple<std::string, std::string, std::string>> received_messages;
+    auto subscriber = session2.declare_subscriber(
+        ke,
+        [&received_messages](const Sample& s) {
+            auto attachment = s.get_attachment();
+            received_messages.emplace_back(s.get_payload().as_string(), s.get_encoding().as_string(),
+                                           attachment.has_value() ? attachment->get().as_string() : "");
+        },
+        closures::none);
+
+    std::this_thread::sleep_for(1s);
+
+    publisher.put(Bytes("first"));
+    Publisher::PutOptions put_options;
+    put_options.encoding = Encoding("application/json");
+    put_options.attachment = Bytes("override");
+    publisher.put(Bytes("second"), std::move(put_options));
+    publisher.set_attachment({});
+    publisher.put(Bytes("third"));
+
+    std::this_thread::sleep_for(1s);
+
+    assert(received_messages.size() == 3);
+    assert(received_messages[0] == std::make_tuple("first", "text/plain", "header"));
+    assert(received_messages[1] == std::make_tuple("second", "application/json", "override"));
+    assert(received_messages[2] == std::make_tuple("third", "text/plain", ""));
+    std::move(subscriber).undeclare();
+    std::move(publisher.get_publisher()).undeclare();
+}
+
 int main(int argc, char** argv) {
     test_with_alloc<CommonAllocator>();
 #if defined Z_FEATURE_SHARED_MEMORY && defined Z_FEATURE_UNSTABLE_API
@@ -240,5 +718,6 @@ int main(int argc, char** argv) {
     test_with_alloc<SHMAllocator, false>();
 #endif
     publisher_get_keyexpr();
+    attaching_publisher();
     return 0;
 }
@@ -163,6 +163,35 @@ void queryable_get_channel() {
     std::move(queryable).undeclare();
 }
 
+void queryable_get_lockfree_channel() {
+    KeyExpr ke("zenoh/test/*");
+    KeyExpr selector("zenoh/test/1");
+    auto session1 = Session::open(Config::create_default());
+    auto session2 = Session::open(Config::create_default());
+    auto queryable = session1.declare_queryable(ke, channels::MpscChannel(4));
+    std::this_thread::sleep_for(1s);
+
+    auto replies = session2.get(selector, "ok", channels::MpscChannel<channels::YieldWait>(4));
+    {
+        auto res = queryable.handler().recv_for(10s);
+        assert(std::holds_alternative<Query>(res));
+        auto& query = std::get<Query>(res);
+        assert(query.get_keyexpr() == selector);
+        assert(query.get_parameters() == "ok");
+        query.reply(query.get_keyexpr(), Bytes("1"));
+    }
+
+    auto res = replies.recv();
+    assert(std::holds_alternative<Reply>(res));
+    assert(std::get<Reply>(res).is_ok());
+    assert(std::get<Reply>(res).get_ok().get_payload().as_string() == "1");
+
+    res = replies.recv();
+    assert(std::holds_alternative<channels::RecvError>(res));
+    assert(std::get<channels::RecvError>(res) == channels::RecvError::Z_DISCONNECTED);
+    std::move(queryable).undeclare();
+}
+
 void queryable_get_keyexpr() {
     KeyExpr ke("zenoh/test_queryable_keyexpr");
     auto session = Session::open(Config::create_default());
@@ -387,6 +416,7 @@ void queryable_querier_accept_replies() {
 int main(int argc, char** argv) {
     queryable_get();
     queryable_get_channel();
+    queryable_get_lockfree_channel();
     queryable_get_keyexpr();
     queryable_get_accept_replies();
     queryable_querier_accept_replies();
@@ -120,10 +120,266 @@ void binary_format_test() {
     assert(check_serialization(vp, {2, 2, 115, 49, 10, 0, 2, 115, 50, 240, 216}));
 }
 
+void serialize_arithmetic_sequence() {
+    assert(zenoh_test_serialization<std::vector<uint8_t>>({1, 2, 255}));
+    assert(zenoh_test_serialization<std::vector<int8_t>>({}));
+    assert(zenoh_test_serialization<std::vector<double>>({}));
+    std::array<uint8_t, 3> a8 = {1, 2, 3};
+    assert(zenoh_test_serialization(a8));
+    std::array<double, 2> ad = {0.25, -1e10};
+    assert(zenoh_test_serialization(ad));
+
+    std::tuple<uint16_t, std::vector<int16_t>, std::vector<uint8_t>, float> t(500, {1, -1}, {7}, 1234.0f);
+    assert(check_serialization(t, {244, 1, 2, 1, 0, 255, 255, 1, 7, 0, 64, 154, 68}));
+    assert(zenoh_test_serialization(t));
+
+    ZResult err = Z_OK;
+    ext::deserialize<std::array<int32_t, 3>>(ext::serialize(std::vector<int32_t>{1, 2}), &err);
+    assert(err == Z_EDESERIALIZE);
+    err = Z_OK;
+    ext::deserialize<std::vector<int32_t>>(ext::serialize(std::make_pair(std::vector<int32_t>{1, 2}, 3)), &err);
+    assert(err == Z_EDESERIALIZE);
+}
+
+void deserialize_views() {
+    std::string str(1000, 'x');
+    Bytes b(ext::serialize(str).as_vector());
+    auto v = ext::deserialize_view<std::string_view>(b);
+    assert(*v == str);
+    assert(v.is_borrowed());
+
+    std::tuple<std::string, std::pair<uint32_t, std::string>, double> t = {"ab", {7, "cd"}, 1.5};
+    Bytes bt(ext::serialize(t).as_vector());
+    auto vt = ext::deserialize_view<std::tuple<std::string_view, std::pair<uint32_t, std::string_view>, double>>(bt);
+    assert(std::get<0>(*vt) == "ab");
+    assert(std::get<1>(*vt).first == 7);
+    assert(std::get<1>(*vt).second == "cd");
+    assert(std::get<2>(*vt) == 1.5);
+    assert(vt.is_borrowed());
+
+    ZResult err = Z_OK;
+    ext::deserialize_view<std::string_view>(bt, &err);
+    assert(err == Z_EDESERIALIZE);
+
+    auto vb = ext::deserialize_view<std::pair<bool, bool>>(Bytes(std::vector<uint8_t>{0, 1}));
+    assert(*vb == std::make_pair(false, true));
+    err = Z_OK;
+    ext::deserialize_view<bool>(Bytes(std::vector<uint8_t>{2}), &err);
+    assert(err == Z_EDESERIALIZE);
+
+    // fragmented payload is copied
+    auto data = ext::serialize(str).as_vector();
+    Bytes::Writer writer;
+    writer.append(Bytes(std::vector<uint8_t>(data.begin(), data.begin() + 10)));
+    writer.append(Bytes(std::vector<uint8_t>(data.begin() + 10, data.end())));
+    Bytes fragmented = std::move(writer).finish();
+    auto vf = ext::deserialize_view<std::string_view>(fragmented);
+    assert(*vf == str);
+
+#if __cplusplus >= 202002L
+    std::vector<float> f = {0.5f, 1.5f, -2.0f};
+    Bytes bf(ext::serialize(std::make_pair(std::string("lidar"), f)).as_vector());
+    auto vs = ext::deserialize_view<std::pair<std::string_view, std::span<const float>>>(bf);
+    assert(vs->first == "lidar");
+    assert(std::vector<float>(vs->second.begin(), vs->second.end()) == f);
+#endif
+}
+
+void deserialize_into_existing() {
+    std::vector<std::vector<float>> vv = {{1.0f, 2.0f, 3.0f}, {4.0f}};
+    std::vector<std::vector<float>> vv_out = {{9.0f, 9.0f, 9.0f, 9.0f}, {8.0f, 8.0f}, {7.0f}};
+    const float* data = vv_out[0].data();
+    ext::deserialize_into(ext::serialize(vv), vv_out);
+    assert(vv_out == vv);
+    assert(vv_out[0].data() == data);
+
+    std::unordered_map<std::string, std::vector<double>> m = {{"a", {1.0, 2.0}}, {"b", {3.0}}};
+    std::unordered_map<std::string, std::vector<double>> m_out = {{"x", {0.0, 0.0, 0.0}}, {"y", {}}, {"z", {}}};
+    ext::deserialize_into(ext::serialize(m), m_out);
+    assert(m_out == m);
+
+    std::map<int32_t, std::string> m2 = {{1, "a"}, {2, "b"}};
+    std::map<int32_t, std::string> m2_out = {{5, "x"}};
+    ext::deserialize_into(ext::serialize(m2), m2_out);
+    assert(m2_out == m2);
+
+    std::set<std::string> s = {"a", "b"};
+    std::set<std::string> s_out = {"q", "r", "s"};
+    ext::deserialize_into(ext::serialize(s), s_out);
+    assert(s_out == s);
+
+    std::vector<bool> vb = {true, false, true};
+    std::vector<bool> vb_out = {false};
+    ext::deserialize_into(ext::serialize(vb), vb_out);
+    assert(vb_out == vb);
+
+    CustomStruct cs = {{0.1, 0.2}, 32, "test"};
+    CustomStruct cs_out = {{1.0, 2.0, 3.0, 4.0}, 0, "a long string which does not fit into small buffer"};
+    const double* vd = cs_out.vd.data();
+    Bytes b = ext::serialize(std::make_pair(cs, uint8_t(5)));
+    ext::Deserializer d(b);
+    d.deserialize_into(cs_out);
+    assert(cs_out.vd == cs.vd);
+    assert(cs_out.vd.data() == vd);
+    assert(cs_out.i == cs.i);
+    assert(cs_out.s == cs.s);
+    assert(d.deserialize<uint8_t>() == 5);
+    assert(d.is_done());
+}
+
+struct Point {
+    int32_t x;
+    int32_t y;
+    ZENOH_EXT_SERIALIZE_FIELDS(x, y)
+
+    bool operator==(const Point& other) const { return x == other.x && y == other.y; }
+};
+
+struct Frame {
+    uint64_t id;
+    std::array<Point, 2> corners;
+    bool valid;
+    double weight;
+    ZENOH_EXT_SERIALIZE_FIELDS(id, corners, valid, weight)
+};
+
+struct Polygon {
+    std::string name;
+    std::vector<Point> points;
+    ZENOH_EXT_SERIALIZE_FIELDS(name, points)
+};
+
+static_assert(ext::detail::fixed_size<Point>::value && ext::detail::fixed_size<Point>::size == 8);
+static_assert(ext::detail::fixed_size<Frame>::size == 8 + (1 + 2 * 8) + 1 + 8);
+static_assert(!ext::detail::fixed_size<Polygon>::value);
+
+void serialize_fields() {
+    Point p{1, -2};
+    Bytes b = ext::serialize(p);
+    assert(b.size() == 8);
+    assert(b.as_vector() == ext::serialize(std::make_tuple(int32_t(1), int32_t(-2))).as_vector());
+    assert(ext::deserialize<Point>(b) == p);
+
+    Frame f{7, {Point{1, 2}, Point{3, 4}}, true, 0.5};
+    ext::Serializer s;
+    s.serialize(f.id);
+    s.serialize(std::vector<Point>(f.corners.begin(), f.corners.end()));
+    s.serialize(f.valid);
+    s.serialize(f.weight);
+    Bytes fb = std::move(s).finish();
+    assert(ext::serialize(f).as_vector() == fb.as_vector());
+    Frame f_out = ext::deserialize<Frame>(fb);
+    assert(f_out.id == f.id && f_out.corners == f.corners && f_out.valid == f.valid && f_out.weight == f.weight);
+
+    Polygon poly{"triangle", {{0, 0}, {1, 0}, {0, 1}}};
+    Polygon poly_out = ext::deserialize<Polygon>(ext::serialize(poly));
+    assert(poly_out.name == poly.name && poly_out.points == poly.points);
+
+    ZResult err = Z_OK;
+    ext::deserialize<Point>(ext::serialize(int32_t(3)), &err);
+    assert(err == Z_EDESERIALIZE);
+    err = Z_OK;
+    ext::deserialize<Point>(ext::serialize(std::make_tuple(int32_t(1), int32_t(2), int32_t(3))), &err);
+    assert(err == Z_EDESERIALIZE);
+}
+
+void deserialize_sequence_lazily() {
+    std::vector<Polygon> polygons = {{"a", {{0, 0}}}, {"b", {{1, 1}, {2, 2}}}, {"c", {}}};
+    ext::Serializer s;
+    s.serialize(polygons);
+    s.serialize(std::string("tail"));
+    Bytes b = std::move(s).finish();
+
+    ext::Deserializer d(b);
+    auto range = d.deserialize_sequence<Polygon>();
+    assert(range.remaining() == 3);
+    size_t i = 0;
+    for (auto& p : range) {
+        assert(p.name == polygons[i].name && p.points == polygons[i].points);
+        i++;
+        assert(range.remaining() == 3 - i);
+    }
+    assert(i == 3);
+    assert(d.deserialize<std::string>() == "tail");
+    assert(d.is_done());
+
+    Bytes b2 = ext::serialize(std::vector<int32_t>{});
+    ext::Deserializer d2(b2);
+    for ([[maybe_unused]] auto& v : d2.deserialize_sequence<int32_t>()) {
+        assert(false);
+    }
+    assert(d2.is_done());
+
+    ZResult err = Z_OK;
+    Bytes b3 = ext::serialize(std::make_tuple(uint8_t(3), int32_t(1), int32_t(2)));
+    ext::Deserializer d3(b3);
+    std::vector<int32_t> out;
+    for (auto v : d3.deserialize_sequence<int32_t>(&err)) {
+        out.push_back(v);
+    }
+    assert(out == std::vector<int32_t>({1, 2}));
+    assert(err == Z_EDESERIALIZE);
+}
+
+void reuse_serializer() {
+    ext::BufferedSerializer s;
+    std::vector<Point> points = {{1, 2}, {3, 4}, {5, 6}};
+    for (int32_t i = 0; i < 3; i++) {
+        s.serialize(i);
+        s.serialize(std::string("value"));
+        s.serialize(points);
+        Bytes b = s.finish();
+        assert(b.as_vector() == ext::serialize(std::make_tuple(i, std::string("value"), points)).as_vector());
+    }
+    s.serialize(uint8_t(1));
+    s.serialize(points);
+    s.reset();
+    s.serialize(uint8_t(2));
+    assert(std::move(s).finish().as_vector() == std::vector<uint8_t>({2}));
+}
+
+void buffered_serializer() {
+    std::vector<float> floats = {0.5f, -1.0f, 2.25f};
+    std::vector<Point> points = {{1, 2}, {3, 4}};
+    CustomStruct custom = {{0.1, 0.2}, 32, "test"};
+
+    ext::Serializer plain;
+    plain.serialize(floats);
+    plain.serialize(points);
+    plain.serialize(custom);
+    ext::BufferedSerializer buffered;
+    buffered.serialize(floats);
+    buffered.serialize(points);
+    buffered.serialize(custom);
+    assert(std::move(plain).finish().as_vector() == std::move(buffered).finish().as_vector());
+
+    // long sequences are written as raw blocks
+    auto nested = std::make_tuple(std::string("cloud"), std::vector<float>(1000, 1.5f), std::vector<Point>(100, {1, 2}),
+                                  std::vector<std::vector<float>>(10, floats));
+    ext::Serializer plain_nested;
+    plain_nested.serialize(nested);
+    assert(ext::serialize(nested).as_vector() == std::move(plain_nested).finish().as_vector());
+    assert(ext::deserialize<decltype(nested)>(ext::serialize(nested)) == nested);
+
+    // Serializer keeps the layout of the zenoh-c serializer
+    ::ze_owned_serializer_t c_serializer;
+    ::ze_serializer_empty(&c_serializer);
+    ext::Serializer& s = interop::as_owned_cpp_ref<ext::Serializer>(&c_serializer);
+    s.serialize(points);
+    assert(std::move(s).finish().as_vector() == ext::serialize(points).as_vector());
+}
+
 int main(int argc, char** argv) {
     serialize_primitive();
     serialize_tuple();
     serialize_container();
     serialize_custom();
     binary_format_test();
+    serialize_arithmetic_sequence();
+    deserialize_views();
+    deserialize_into_existing();
+    serialize_fields();
+    deserialize_sequence_lazily();
+    reuse_serializer();
+    buffered_serializer();
 }